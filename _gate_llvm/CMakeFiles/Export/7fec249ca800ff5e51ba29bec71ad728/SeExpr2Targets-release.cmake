@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "SeExpr2::SeExpr2" for configuration "Release"
+set_property(TARGET SeExpr2::SeExpr2 APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(SeExpr2::SeExpr2 PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libSeExpr2.so.2.0"
+  IMPORTED_SONAME_RELEASE "libSeExpr2.so.2"
+  )
+
+list(APPEND _cmake_import_check_targets SeExpr2::SeExpr2 )
+list(APPEND _cmake_import_check_files_for_SeExpr2::SeExpr2 "${_IMPORT_PREFIX}/lib/libSeExpr2.so.2.0" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_llvm
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src/SeExpr2")
+subdirs("src/SeExpr2/UI")
+subdirs("src/py")
+subdirs("src/utils")
+subdirs("src/demos")
+subdirs("src/tests")
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/SeExpr2/CPUDispatch.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/CPUDispatch.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/CPUDispatch.cpp.o.d"
+  "/root/repo/src/SeExpr2/Context.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Context.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Context.cpp.o.d"
+  "/root/repo/src/SeExpr2/ContextUtils.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ContextUtils.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ContextUtils.cpp.o.d"
+  "/root/repo/src/SeExpr2/Curve.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Curve.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Curve.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprBuiltins.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprBuiltins.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprBuiltins.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprEnv.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprEnv.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprEnv.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprFunc.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprFunc.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprFunc.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprFuncStandard.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprFuncStandard.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprFuncStandard.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprFuncX.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprFuncX.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprFuncX.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprLLVMCodeGeneration.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprLLVMCodeGeneration.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprLLVMCodeGeneration.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprMultiExpr.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprMultiExpr.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprMultiExpr.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprNode.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprNode.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprNode.cpp.o.d"
+  "/root/repo/_gate_llvm/src/SeExpr2/ExprParser.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprParser.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprParser.cpp.o.d"
+  "/root/repo/_gate_llvm/src/SeExpr2/ExprParserLex.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprParserLex.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprParserLex.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExprWalker.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprWalker.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExprWalker.cpp.o.d"
+  "/root/repo/src/SeExpr2/Expression.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Expression.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Expression.cpp.o.d"
+  "/root/repo/src/SeExpr2/ExpressionGroup.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExpressionGroup.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ExpressionGroup.cpp.o.d"
+  "/root/repo/src/SeExpr2/Interpreter.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Interpreter.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Interpreter.cpp.o.d"
+  "/root/repo/src/SeExpr2/Mutex.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Mutex.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Mutex.cpp.o.d"
+  "/root/repo/src/SeExpr2/Noise.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Noise.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Noise.cpp.o.d"
+  "/root/repo/_gate_llvm/src/SeExpr2/NoiseKernels.bc.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/NoiseKernels.bc.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/NoiseKernels.bc.cpp.o.d"
+  "/root/repo/src/SeExpr2/SeContext.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/SeContext.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/SeContext.cpp.o.d"
+  "/root/repo/src/SeExpr2/StringArena.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/StringArena.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/StringArena.cpp.o.d"
+  "/root/repo/src/SeExpr2/ThreadPool.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ThreadPool.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/ThreadPool.cpp.o.d"
+  "/root/repo/src/SeExpr2/Timer.cpp" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Timer.cpp.o" "gcc" "src/SeExpr2/CMakeFiles/SeExpr2.dir/Timer.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_llvm/src/SeExpr2/libSeExpr2.so" "/root/repo/_gate_llvm/src/SeExpr2/libSeExpr2.so.2.0"
+  "/root/repo/_gate_llvm/src/SeExpr2/libSeExpr2.so.2" "/root/repo/_gate_llvm/src/SeExpr2/libSeExpr2.so.2.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
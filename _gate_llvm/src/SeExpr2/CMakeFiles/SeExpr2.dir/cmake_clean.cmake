@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SeExpr2.dir/CPUDispatch.cpp.o"
+  "CMakeFiles/SeExpr2.dir/CPUDispatch.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Context.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Context.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ContextUtils.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ContextUtils.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Curve.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Curve.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprBuiltins.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprBuiltins.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprEnv.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprEnv.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprFunc.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprFunc.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprFuncStandard.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprFuncStandard.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprFuncX.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprFuncX.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprLLVMCodeGeneration.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprLLVMCodeGeneration.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprMultiExpr.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprMultiExpr.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprNode.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprNode.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprParser.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprParser.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprParserLex.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprParserLex.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExprWalker.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExprWalker.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Expression.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Expression.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ExpressionGroup.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ExpressionGroup.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Interpreter.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Interpreter.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Mutex.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Mutex.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Noise.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Noise.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/NoiseKernels.bc.cpp.o"
+  "CMakeFiles/SeExpr2.dir/NoiseKernels.bc.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/SeContext.cpp.o"
+  "CMakeFiles/SeExpr2.dir/SeContext.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/StringArena.cpp.o"
+  "CMakeFiles/SeExpr2.dir/StringArena.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/ThreadPool.cpp.o"
+  "CMakeFiles/SeExpr2.dir/ThreadPool.cpp.o.d"
+  "CMakeFiles/SeExpr2.dir/Timer.cpp.o"
+  "CMakeFiles/SeExpr2.dir/Timer.cpp.o.d"
+  "libSeExpr2.pdb"
+  "libSeExpr2.so"
+  "libSeExpr2.so.2"
+  "libSeExpr2.so.2.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SeExpr2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+// Generated by EmbedBitcode.cmake
+#include <cstddef>
+extern "C" {
+extern const unsigned char SeExpr2NoiseKernels[] = {0};
+extern const size_t SeExpr2NoiseKernelsSize = 0;
+}
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/SeExpr2/UI
+# Build directory: /root/repo/_gate_llvm/src/SeExpr2/UI
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
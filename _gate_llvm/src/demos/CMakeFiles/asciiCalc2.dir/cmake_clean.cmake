@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/asciiCalc2.dir/asciiCalculator.cpp.o"
+  "CMakeFiles/asciiCalc2.dir/asciiCalculator.cpp.o.d"
+  "asciiCalc2"
+  "asciiCalc2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asciiCalc2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/asciiGraph2.dir/asciiGraph.cpp.o"
+  "CMakeFiles/asciiGraph2.dir/asciiGraph.cpp.o.d"
+  "asciiGraph2"
+  "asciiGraph2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asciiGraph2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/demos
+# Build directory: /root/repo/_gate_llvm/src/demos
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("imageSynth")
+subdirs("imageEditor")
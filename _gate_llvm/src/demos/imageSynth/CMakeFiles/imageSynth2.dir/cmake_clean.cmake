@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imageSynth2.dir/imageSynth.cpp.o"
+  "CMakeFiles/imageSynth2.dir/imageSynth.cpp.o.d"
+  "imageSynth2"
+  "imageSynth2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imageSynth2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
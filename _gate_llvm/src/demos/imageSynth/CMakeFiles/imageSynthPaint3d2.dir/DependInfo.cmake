@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/demos/imageSynth/imageSynthForPaint3d.cpp" "src/demos/imageSynth/CMakeFiles/imageSynthPaint3d2.dir/imageSynthForPaint3d.cpp.o" "gcc" "src/demos/imageSynth/CMakeFiles/imageSynthPaint3d2.dir/imageSynthForPaint3d.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_llvm/src/SeExpr2/CMakeFiles/SeExpr2.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
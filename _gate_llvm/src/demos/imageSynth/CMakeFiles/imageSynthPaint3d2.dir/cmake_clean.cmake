@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imageSynthPaint3d2.dir/imageSynthForPaint3d.cpp.o"
+  "CMakeFiles/imageSynthPaint3d2.dir/imageSynthForPaint3d.cpp.o.d"
+  "imageSynthPaint3d2"
+  "imageSynthPaint3d2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imageSynthPaint3d2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
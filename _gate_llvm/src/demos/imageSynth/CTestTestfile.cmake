@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/demos/imageSynth
+# Build directory: /root/repo/_gate_llvm/src/demos/imageSynth
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
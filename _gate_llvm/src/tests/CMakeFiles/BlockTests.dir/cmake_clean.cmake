@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BlockTests"
+  "BlockTests.pdb"
+  "CMakeFiles/BlockTests.dir/BlockTests.cpp.o"
+  "CMakeFiles/BlockTests.dir/BlockTests.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BlockTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
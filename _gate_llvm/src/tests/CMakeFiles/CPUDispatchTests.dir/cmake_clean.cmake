@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CPUDispatchTests.dir/CPUDispatchTests.cpp.o"
+  "CMakeFiles/CPUDispatchTests.dir/CPUDispatchTests.cpp.o.d"
+  "CPUDispatchTests"
+  "CPUDispatchTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CPUDispatchTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ChannelTests.dir/ChannelTests.cpp.o"
+  "CMakeFiles/ChannelTests.dir/ChannelTests.cpp.o.d"
+  "ChannelTests"
+  "ChannelTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ChannelTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
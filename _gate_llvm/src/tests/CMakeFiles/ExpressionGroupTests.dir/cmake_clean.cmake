@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ExpressionGroupTests.dir/ExpressionGroupTests.cpp.o"
+  "CMakeFiles/ExpressionGroupTests.dir/ExpressionGroupTests.cpp.o.d"
+  "ExpressionGroupTests"
+  "ExpressionGroupTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ExpressionGroupTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
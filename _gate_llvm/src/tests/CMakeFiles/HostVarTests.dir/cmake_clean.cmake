@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HostVarTests.dir/HostVarTests.cpp.o"
+  "CMakeFiles/HostVarTests.dir/HostVarTests.cpp.o.d"
+  "HostVarTests"
+  "HostVarTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HostVarTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
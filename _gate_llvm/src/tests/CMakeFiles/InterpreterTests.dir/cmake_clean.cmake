@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InterpreterTests.dir/InterpreterTests.cpp.o"
+  "CMakeFiles/InterpreterTests.dir/InterpreterTests.cpp.o.d"
+  "InterpreterTests"
+  "InterpreterTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/InterpreterTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParallelEvalTests.dir/ParallelEvalTests.cpp.o"
+  "CMakeFiles/ParallelEvalTests.dir/ParallelEvalTests.cpp.o.d"
+  "ParallelEvalTests"
+  "ParallelEvalTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParallelEvalTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PrecompiledTestLibrary.dir/PrecompiledTestLibrary.cpp.o"
+  "CMakeFiles/PrecompiledTestLibrary.dir/PrecompiledTestLibrary.cpp.o.d"
+  "libPrecompiledTestLibrary.pdb"
+  "libPrecompiledTestLibrary.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PrecompiledTestLibrary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
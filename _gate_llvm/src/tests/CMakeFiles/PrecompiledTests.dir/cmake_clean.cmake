@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PrecompiledTests.dir/PrecompiledTests.cpp.o"
+  "CMakeFiles/PrecompiledTests.dir/PrecompiledTests.cpp.o.d"
+  "PrecompiledTests"
+  "PrecompiledTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PrecompiledTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
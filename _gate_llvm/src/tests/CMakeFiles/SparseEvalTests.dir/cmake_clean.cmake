@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SparseEvalTests.dir/SparseEvalTests.cpp.o"
+  "CMakeFiles/SparseEvalTests.dir/SparseEvalTests.cpp.o.d"
+  "SparseEvalTests"
+  "SparseEvalTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SparseEvalTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
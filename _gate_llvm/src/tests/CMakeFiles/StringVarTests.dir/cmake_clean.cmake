@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StringVarTests.dir/StringVarTests.cpp.o"
+  "CMakeFiles/StringVarTests.dir/StringVarTests.cpp.o.d"
+  "StringVarTests"
+  "StringVarTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StringVarTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VarBlockExample.dir/VarBlockExample.cpp.o"
+  "CMakeFiles/VarBlockExample.dir/VarBlockExample.cpp.o.d"
+  "VarBlockExample"
+  "VarBlockExample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/VarBlockExample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dirtSimple.dir/dirtSimple.cpp.o"
+  "CMakeFiles/dirtSimple.dir/dirtSimple.cpp.o.d"
+  "dirtSimple"
+  "dirtSimple.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dirtSimple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/tests
+# Build directory: /root/repo/_gate_llvm/src/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(imageTestsReport "/root/.pyenv/shims/python" "/root/repo/src/tests/imageTestsReportNew.py" "runall")
+set_tests_properties(imageTestsReport PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;83;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(basicPython "/root/.pyenv/shims/python" "/root/repo/src/tests/basicPython.py")
+set_tests_properties(basicPython PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;86;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(dirtSimple "/root/repo/_gate_llvm/src/tests/dirtSimple")
+set_tests_properties(dirtSimple PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;92;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(BlockTests "/root/repo/_gate_llvm/src/tests/BlockTests")
+set_tests_properties(BlockTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;97;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(InterpreterTests "/root/repo/_gate_llvm/src/tests/InterpreterTests")
+set_tests_properties(InterpreterTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;102;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(ExpressionGroupTests "/root/repo/_gate_llvm/src/tests/ExpressionGroupTests")
+set_tests_properties(ExpressionGroupTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;107;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(CPUDispatchTests "/root/repo/_gate_llvm/src/tests/CPUDispatchTests")
+set_tests_properties(CPUDispatchTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;112;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(ParallelEvalTests "/root/repo/_gate_llvm/src/tests/ParallelEvalTests")
+set_tests_properties(ParallelEvalTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;117;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(ChannelTests "/root/repo/_gate_llvm/src/tests/ChannelTests")
+set_tests_properties(ChannelTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;122;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(StringVarTests "/root/repo/_gate_llvm/src/tests/StringVarTests")
+set_tests_properties(StringVarTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;127;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(SparseEvalTests "/root/repo/_gate_llvm/src/tests/SparseEvalTests")
+set_tests_properties(SparseEvalTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;132;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(HostVarTests "/root/repo/_gate_llvm/src/tests/HostVarTests")
+set_tests_properties(HostVarTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;137;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
+add_test(PrecompiledTests "/root/repo/_gate_llvm/src/tests/PrecompiledTests" "/root/repo/_gate_llvm/src/tests/libPrecompiledTestLibrary.so")
+set_tests_properties(PrecompiledTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/tests/CMakeLists.txt;146;add_test;/root/repo/src/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/eval.dir/eval.cpp.o"
+  "CMakeFiles/eval.dir/eval.cpp.o.d"
+  "eval"
+  "eval.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eval.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
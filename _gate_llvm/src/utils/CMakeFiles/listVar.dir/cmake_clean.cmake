@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/listVar.dir/listVar.cpp.o"
+  "CMakeFiles/listVar.dir/listVar.cpp.o.d"
+  "listVar"
+  "listVar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/listVar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
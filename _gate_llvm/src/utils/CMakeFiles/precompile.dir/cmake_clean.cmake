@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/precompile.dir/precompile.cpp.o"
+  "CMakeFiles/precompile.dir/precompile.cpp.o.d"
+  "precompile"
+  "precompile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/precompile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
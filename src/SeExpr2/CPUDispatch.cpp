@@ -0,0 +1,78 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "CPUDispatch.h"
+
+namespace SeExpr2 {
+
+namespace {
+
+ISALevel detectISALevel() {
+#ifdef SEEXPR_MULTIVERSION
+    // __builtin_cpu_supports also checks that the os saves the wider registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw"))
+        return ISAAVX512;
+    if (__builtin_cpu_supports("avx2")) return ISAAVX2;
+#ifdef SEEXPR_MULTIVERSION_SSE41
+    if (__builtin_cpu_supports("sse4.1")) return ISASSE41;
+#endif
+#endif
+    return ISABaseline;
+}
+
+//! The selected level, initially the host's capped by SE_EXPR_ISA
+std::atomic<int>& selected() {
+    static std::atomic<int> level([] {
+        ISALevel host = hostISALevel();
+        const char* cap = getenv("SE_EXPR_ISA");
+        for (int l = ISABaseline; cap && l < host; l++)
+            if (!strcmp(cap, isaLevelName(ISALevel(l)))) return l;
+        return int(host);
+    }());
+    return level;
+}
+}
+
+ISALevel hostISALevel() {
+    static const ISALevel host = detectISALevel();
+    return host;
+}
+
+ISALevel selectedISALevel() { return ISALevel(selected().load(std::memory_order_relaxed)); }
+
+void setISALevel(ISALevel level) {
+    selected().store(level < hostISALevel() ? level : hostISALevel(), std::memory_order_relaxed);
+}
+
+const char* isaLevelName(ISALevel level) {
+    switch (level) {
+        case ISASSE41:
+            return "sse4.1";
+        case ISAAVX2:
+            return "avx2";
+        case ISAAVX512:
+            return "avx512";
+        default:
+            return "baseline";
+    }
+}
+}
@@ -0,0 +1,125 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#ifndef CPUDispatch_h
+#define CPUDispatch_h
+
+#include <utility>
+
+// The hot kernels (noise, curves, interpreter batch ops...) are compiled once for the baseline instruction set the
+// library is built for and once more for each level above it, and the copy run is picked at run time from what
+// the cpu supports. This needs the gcc/clang target attribute on x86; elsewhere, or with SEEXPR_NO_MULTIVERSION defined (as
+// when the noise kernels are compiled to bitcode for the JIT, which targets the host itself), kernels are called
+// directly.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(SEEXPR_NO_MULTIVERSION)
+#define SEEXPR_MULTIVERSION 1
+// flatten inlines everything the kernel calls into the copy, so that it's all compiled for the level
+// a library built for sse4.1 already (ENABLE_SSE4) has no use for an sse4.1 copy
+#ifndef __SSE4_1__
+#define SEEXPR_MULTIVERSION_SSE41 1
+#define SEEXPR_TARGET_SSE41 __attribute__((target("sse4.1"), flatten))
+#endif
+#define SEEXPR_TARGET_AVX2 __attribute__((target("avx2"), flatten))
+#define SEEXPR_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw"), flatten))
+#endif
+
+namespace SeExpr2 {
+
+//! Instruction set levels the kernels are compiled for, in increasing order
+enum ISALevel {
+    ISABaseline,  //!< whatever the library was built for
+    ISASSE41,     //!< only above the baseline in builds without ENABLE_SSE4
+    ISAAVX2,
+    ISAAVX512  //!< AVX-512 F, DQ, VL and BW
+};
+
+//! Highest level the host cpu (and os) supports, found with cpuid. Baseline in builds without multi-versioned kernels.
+ISALevel hostISALevel();
+
+//! Level whose kernels run: the host's, unless lowered by SE_EXPR_ISA (baseline, sse4.1, avx2 or avx512) or
+//! setISALevel
+ISALevel selectedISALevel();
+
+//! Runs the kernels of level (or of the host's level if it's lower) from now on. Interpreter programs keep the batch
+//! ops of the level selected when they were built.
+void setISALevel(ISALevel level);
+
+//! Name of level as SE_EXPR_ISA takes it
+const char* isaLevelName(ISALevel level);
+
+#ifdef SEEXPR_MULTIVERSION
+//! Copies of K::run(args...) compiled for each level
+#ifdef SEEXPR_MULTIVERSION_SSE41
+template <class K, class... Args>
+SEEXPR_TARGET_SSE41 void runSSE41(Args... args) {
+    K::run(std::forward<Args>(args)...);
+}
+#endif
+
+template <class K, class... Args>
+SEEXPR_TARGET_AVX2 void runAVX2(Args... args) {
+    K::run(std::forward<Args>(args)...);
+}
+
+template <class K, class... Args>
+SEEXPR_TARGET_AVX512 void runAVX512(Args... args) {
+    K::run(std::forward<Args>(args)...);
+}
+#endif
+
+//! Calls the static function K::run(args...) compiled for the selected level
+template <class K, class... Args>
+inline void dispatch(Args&&... args) {
+#ifdef SEEXPR_MULTIVERSION
+    switch (selectedISALevel()) {
+        case ISAAVX512:
+            return runAVX512<K, Args&&...>(std::forward<Args>(args)...);
+        case ISAAVX2:
+            return runAVX2<K, Args&&...>(std::forward<Args>(args)...);
+#ifdef SEEXPR_MULTIVERSION_SSE41
+        case ISASSE41:
+            return runSSE41<K, Args&&...>(std::forward<Args>(args)...);
+#endif
+        default:
+            break;
+    }
+#endif
+    K::run(std::forward<Args>(args)...);
+}
+
+//! Pointer to K::run (taking Args) compiled for the selected level, for callers that keep the kernel to call
+template <class K, class... Args>
+inline auto selectKernel() -> void (*)(Args...) {
+#ifdef SEEXPR_MULTIVERSION
+    switch (selectedISALevel()) {
+        case ISAAVX512:
+            return runAVX512<K, Args...>;
+        case ISAAVX2:
+            return runAVX2<K, Args...>;
+#ifdef SEEXPR_MULTIVERSION_SSE41
+        case ISASSE41:
+            return runSSE41<K, Args...>;
+#endif
+        default:
+            break;
+    }
+#endif
+    return K::run;
+}
+}
+
+#endif
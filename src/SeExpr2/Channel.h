@@ -0,0 +1,157 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#ifndef Channel_h
+#define Channel_h
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SeExpr2 {
+
+/// Element type of the data of a variable block variable (see VarBlockCreator::registerVariable)
+enum class ChannelType : uint8_t {
+    Native = 0,  ///< double, or float for expressions evaluated with Expression::UseFloat
+    Float64,
+    Float32,
+    Half,   ///< IEEE 754 binary16
+    UInt8   ///< 0..255 read as 0..1, written clamped to [0,1] and rounded
+};
+
+/// Layout of the data of a variable: the components of a point are consecutive elements of type and the points are
+/// byteStride bytes apart. A zero format is the native layout (packed points of the evaluation precision).
+struct ChannelFormat {
+    ChannelType type;
+    uint32_t byteStride;
+};
+
+/// Size of an element of type (0 for Native, whose size depends on the evaluation precision)
+inline size_t channelTypeSize(ChannelType type) {
+    switch (type) {
+        case ChannelType::Float64:
+            return sizeof(double);
+        case ChannelType::Float32:
+            return sizeof(float);
+        case ChannelType::Half:
+            return sizeof(uint16_t);
+        case ChannelType::UInt8:
+            return sizeof(uint8_t);
+        default:
+            return 0;
+    }
+}
+
+/// Element of a half channel (a type of its own so that conversions can overload on it)
+struct Half {
+    uint16_t bits;
+};
+
+/// Value of the half with the given bits
+inline float halfToFloat(uint16_t h) {
+    uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16, exponent = (h >> 10) & 0x1f, mantissa = h & 0x3ff;
+    uint32_t bits;
+    if (exponent == 0x1f)
+        bits = sign | 0x7f800000 | (mantissa << 13);  // infinity or nan
+    else if (exponent)
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    else {
+        // zero or subnormal, mantissa units of 2^-24 (exact in float)
+        float value = mantissa * 5.9604644775390625e-8f;
+        memcpy(&bits, &value, sizeof(bits));
+        bits |= sign;
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+/// Nearest half to f (ties to even), infinite past the largest half
+inline uint16_t floatToHalf(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    uint16_t sign = (bits >> 16) & 0x8000;
+    uint32_t abs = bits & 0x7fffffff;
+    if (abs > 0x7f800000) return sign | 0x7e00;   // nan
+    if (abs >= 0x47800000) return sign | 0x7c00;  // 2^16 and up (infinity included)
+    if (abs < 0x33000000) return sign;            // under half the smallest subnormal
+    uint32_t h, rest, half;
+    if (abs >= 0x38800000) {
+        // normal: rebias the exponent, a rounding carry into it is right (up to infinity)
+        h = (abs - 0x38000000) >> 13;
+        rest = abs & 0x1fff;
+        half = 0x1000;
+    } else {
+        // subnormal: the mantissa (with its implicit bit) in units of 2^-24
+        uint32_t mantissa = (abs & 0x7fffff) | 0x800000;
+        int shift = 126 - static_cast<int>(abs >> 23);
+        h = mantissa >> shift;
+        rest = mantissa & ((1u << shift) - 1);
+        half = 1u << (shift - 1);
+    }
+    if (rest > half || (rest == half && (h & 1))) h++;
+    return static_cast<uint16_t>(sign | h);
+}
+
+/// Value of an element of a channel
+inline double channelValue(double v) { return v; }
+inline double channelValue(float v) { return v; }
+inline double channelValue(Half v) { return halfToFloat(v.bits); }
+inline double channelValue(uint8_t v) { return v * (1. / 255); }
+
+/// Stores v into an element of a channel (half rounds through float)
+inline void setChannelValue(double& element, double v) { element = v; }
+inline void setChannelValue(float& element, double v) { element = static_cast<float>(v); }
+inline void setChannelValue(Half& element, double v) { element.bits = floatToHalf(static_cast<float>(v)); }
+inline void setChannelValue(uint8_t& element, double v) {
+    // nan clamps to 0
+    element = static_cast<uint8_t>((v > 0 ? (v < 1 ? v : 1) : 0) * 255 + .5);
+}
+
+template <class S, class T>
+void storeChannelAs(const ChannelFormat& format, char* base, size_t firstPoint, size_t numPoints, int dim,
+                    const T* values, size_t componentStride, size_t pointStride) {
+    for (size_t i = 0; i < numPoints; i++) {
+        S* dest = reinterpret_cast<S*>(base + format.byteStride * (firstPoint + i));
+        for (int k = 0; k < dim; k++) setChannelValue(dest[k], values[i * pointStride + k * componentStride]);
+    }
+}
+
+/// Converts the dim values of numPoints points into the channel of the given (non native) format at base, starting
+/// with point firstPoint. Component k of point i is values[i*pointStride+k*componentStride].
+template <class T>
+void storeChannel(const ChannelFormat& format, char* base, size_t firstPoint, size_t numPoints, int dim,
+                  const T* values, size_t componentStride, size_t pointStride) {
+    switch (format.type) {
+        case ChannelType::Float64:
+            return storeChannelAs<double>(format, base, firstPoint, numPoints, dim, values, componentStride,
+                                          pointStride);
+        case ChannelType::Float32:
+            return storeChannelAs<float>(format, base, firstPoint, numPoints, dim, values, componentStride,
+                                         pointStride);
+        case ChannelType::Half:
+            return storeChannelAs<Half>(format, base, firstPoint, numPoints, dim, values, componentStride,
+                                        pointStride);
+        case ChannelType::UInt8:
+            return storeChannelAs<uint8_t>(format, base, firstPoint, numPoints, dim, values, componentStride,
+                                           pointStride);
+        default:
+            break;
+    }
+}
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include <algorithm>
 
 #include "Curve.h"
+#include "CPUDispatch.h"
 
 namespace SeExpr2 {
 
@@ -101,7 +102,7 @@ void Curve<T>::preparePoints() {
 // TODO: this function and the next could be merged with template magic
 //       but it might be simpler to just have two copies!
 template <class T>
-T Curve<T>::getValue(const double param) const {
+T Curve<T>::value(const double param) const {
     assert(prepared);
     // find the cv data point index just greater than the desired param
     const int numPoints = static_cast<int>(_cvData.size());
@@ -147,7 +148,7 @@ T Curve<T>::getValue(const double param) const {
 // TODO: this function and the previous could be merged with template magic
 //       but it might be simpler to just have two copies!
 template <class T>
-double Curve<T>::getChannelValue(const double param, int channel) const {
+double Curve<T>::channelValue(const double param, int channel) const {
     assert(prepared);
     // find the cv data point index just greater than the desired param
     const int numPoints = static_cast<int>(_cvData.size());
@@ -195,6 +196,32 @@ double Curve<T>::getChannelValue(const double param, int channel) const {
     }
 }
 
+template <class T>
+struct Curve<T>::ValueKernel {
+    static void run(const Curve& curve, double param, T& result) { result = curve.value(param); }
+};
+
+template <class T>
+struct Curve<T>::ChannelValueKernel {
+    static void run(const Curve& curve, double param, int channel, double& result) {
+        result = curve.channelValue(param, channel);
+    }
+};
+
+template <class T>
+T Curve<T>::getValue(const double param) const {
+    T result;
+    dispatch<ValueKernel>(*this, param, result);
+    return result;
+}
+
+template <class T>
+double Curve<T>::getChannelValue(const double param, int channel) const {
+    double result;
+    dispatch<ChannelValueKernel>(*this, param, channel, result);
+    return result;
+}
+
 template <class T>
 typename Curve<T>::CV Curve<T>::getLowerBoundCV(const double param) const {
     assert(prepared);
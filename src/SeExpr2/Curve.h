@@ -86,6 +86,13 @@ class Curve {
     static bool cvLessThan(const CV& cv1, const CV& cv2);
 
   private:
+    //! getValue and getChannelValue, which run them compiled for the selected instruction set level (see
+    //! CPUDispatch.h)
+    T value(const double param) const;
+    double channelValue(const double param, int channel) const;
+    struct ValueKernel;
+    struct ChannelValueKernel;
+
     //! Performs hermite derivative clamping in canonical space
     void clampCurveSegment(const T& delta, T& d1, T& d2);
 
@@ -17,26 +17,170 @@
 
 #include "ExprConfig.h"
 #include "ExprLLVMAll.h"
+#include "ExprNode.h"
+#include "ExprFunc.h"
+#include "ExprFuncStandard.h"
+#include "Expression.h"
 #include "VarBlock.h"
+#include "CPUDispatch.h"
+#include "StringArena.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <typeinfo>
 
 #ifdef SEEXPR_ENABLE_LLVM
+#include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/Bitcode/BitcodeReader.h>
 #include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Mangler.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/MC/MCSubtargetInfo.h>
+#if (LLVM_VERSION_MAJOR >= 14)
+#include <llvm/MC/TargetRegistry.h>
+#else
+#include <llvm/Support/TargetRegistry.h>
+#endif
 #include <llvm/Support/Compiler.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+#include "ExprBuiltins.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <set>
+#ifdef SEEXPR_WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 #endif
 
 extern "C" void SeExpr2LLVMEvalFPVarRef(SeExpr2::ExprVarRef *seVR, double *result);
 extern "C" void SeExpr2LLVMEvalStrVarRef(SeExpr2::ExprVarRef *seVR, double *result);
+extern "C" char *SeExpr2LLVMEvalStrConcat(SeExpr2::StringArena *strings, const char *a, const char *b);
+extern "C" int SeExpr2LLVMEvalStrEqual(const char *a, const char *b);
 extern "C" void SeExpr2LLVMEvalCustomFunction(int *opDataArg,
                                               double *fpArg,
                                               char **strArg,
                                               void **funcdata,
                                               const SeExpr2::ExprFuncNode *node);
+#ifdef SEEXPR_ENABLE_LLVM
+// bitcode of kernels/NoiseKernels.cpp (empty when the build had no clang)
+extern "C" const unsigned char SeExpr2NoiseKernels[];
+extern "C" const size_t SeExpr2NoiseKernelsSize;
+#endif
 
 namespace SeExpr2 {
+
+//! Name of the external symbol generated code calls the standard function registered as name through
+std::string standardFunctionSymbol(const std::string &name);
+//! Name of the external symbol generated code calls the native entry point of the custom function object func
+//! (registered as name) through
+std::string nativeFunctionSymbol(const std::string &name, const ExprFuncX *func);
+//! File of the plugin (or other shared object) defining address, empty for the library's own code or if unknown
+std::string functionOrigin(const void *address);
 #ifdef SEEXPR_ENABLE_LLVM
+//! Declares the slot named name that the code generated for the custom function call funcNode loads its node from
+//! (the slot is set once the code is loaded, so the machine code doesn't depend on the node's address)
+void declareCustomFunctionSlot(llvm::Module *module, const ExprFuncNode *funcNode, const std::string &name);
+#endif
 
-LLVM_VALUE promoteToDim(LLVM_VALUE val, unsigned dim, llvm::IRBuilder<> &Builder);
+//! 64 bit FNV-1a hash of key, in hex
+inline std::string codeHash(const std::string &key) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : key) hash = (hash ^ c) * 1099511628211ULL;
+    std::ostringstream o;
+    o << std::setbase(16) << hash;
+    return o.str();
+}
 
+//! Appends to key what the code generated for node depends on besides the expression text and collects the
+//! standard functions and native entry points it calls. Functions are keyed by their name, type and the plugin
+//! defining them. Clears cacheable when the code would embed addresses only valid in this process (host variables).
+inline void collectCodeDependencies(const ExprNode *node,
+                                    std::string &key,
+                                    bool &cacheable,
+                                    std::map<std::string, void *> &standardFunctions) {
+    if (const ExprVarNode *varNode = dynamic_cast<const ExprVarNode *>(node)) {
+        if (const VarBlockCreator::Ref *ref = dynamic_cast<const VarBlockCreator::Ref *>(varNode->var())) {
+            std::ostringstream o;
+            o << "var " << varNode->name() << " " << ref->type().toString() << " " << ref->offset() << " "
+              << ref->stride();
+            if (ref->format().type != ChannelType::Native)
+                o << " channel " << static_cast<int>(ref->format().type) << " " << ref->format().byteStride;
+            o << "\n";
+            key += o.str();
+        } else if (varNode->var())
+            cacheable = false;
+    } else if (const ExprFuncNode *funcNode = dynamic_cast<const ExprFuncNode *>(node)) {
+        const ExprFunc *func = funcNode->func();
+        const ExprFuncStandard *standard = func ? dynamic_cast<const ExprFuncStandard *>(func->funcx()) : nullptr;
+        if (standard) {
+            std::string origin = functionOrigin(standard->getFuncPointer());
+            key += "func " + std::string(funcNode->name()) + " " + std::to_string(standard->getFuncType()) +
+                   (origin.empty() ? "" : " from " + origin) + "\n";
+            standardFunctions[standardFunctionSymbol(funcNode->name())] = standard->getFuncPointer();
+        } else if (func && std::string(funcNode->name()) != "printf") {
+            const std::type_info &type = typeid(*func->funcx());
+            std::string origin = functionOrigin(&type);
+            key += "custom " + std::string(funcNode->name()) + " " + type.name() +
+                   (origin.empty() ? "" : " from " + origin) + "\n";
+            const ExprFuncSimple *simple = dynamic_cast<const ExprFuncSimple *>(func->funcx());
+            if (simple && simple->nativeFunction() && funcNode->type().isFP())
+                standardFunctions[nativeFunctionSymbol(funcNode->name(), simple)] = (void *)simple->nativeFunction();
+        }
+    }
+    for (int i = 0; i < node->numChildren(); i++)
+        collectCodeDependencies(node->child(i), key, cacheable, standardFunctions);
+}
+
+//! Collects the calls of custom functions under node, in the order of the tree (see declareCustomFunctionSlot)
+inline void collectCustomFunctionCalls(const ExprNode *node, std::vector<const ExprFuncNode *> &calls) {
+    if (const ExprFuncNode *funcNode = dynamic_cast<const ExprFuncNode *>(node)) {
+        const ExprFunc *func = funcNode->func();
+        if (func && !dynamic_cast<const ExprFuncStandard *>(func->funcx()) && std::string(funcNode->name()) != "printf")
+            calls.push_back(funcNode);
+    }
+    for (int i = 0; i < node->numChildren(); i++) collectCustomFunctionCalls(node->child(i), calls);
+}
+
+//! Describes the code generated for a prepared parse tree independently of the compiler: the text, return type and
+//! precision, variable block layout and standard functions (see collectCodeDependencies)
+inline std::string codeKey(ExprNode *parseTree,
+                           ExprType desiredReturnType,
+                           bool singlePrecision,
+                           bool &cacheable,
+                           std::map<std::string, void *> &standardFunctions) {
+    std::string key = "type " + desiredReturnType.toString() + (singlePrecision ? " float\n" : " double\n") +
+                      parseTree->expr()->getExpr() + "\n";
+    collectCodeDependencies(parseTree, key, cacheable, standardFunctions);
+    return key;
+}
+
+//! Prefix of the names of the functions (_func and _loopfunc) and key (_key) of a precompiled expression
+inline std::string precompiledSymbol(const std::string &key) { return "SeExpr2AOT_" + codeHash(key); }
+//! End of the key a precompiled library holds for an expression: the cpu and features it was compiled for, and the
+//! instruction set level (see CPUDispatch.h) they need, which bindPrecompiled checks is selected
+inline std::string precompiledTarget(const std::string &cpu, const std::string &features, ISALevel level) {
+    return "target " + cpu + (features.empty() ? "" : " " + features) + "\nisa " + isaLevelName(level) + "\n";
+}
+//! Name of the slot holding the address of the external function symbol precompiled code calls
+inline std::string precompiledImport(const std::string &symbol) { return "SeExpr2AOT_import_" + symbol; }
+
+//! Runs the code LLVM generated for an expression, compiled in memory or loaded from a precompiled library
 class LLVMEvaluator {
     // TODO: this seems needlessly complex, let's fix it
     // TODO: let the dev code allocate memory?
@@ -44,8 +188,8 @@ class LLVMEvaluator {
     template <class T>
     class LLVMEvaluationContext {
       private:
-        typedef void (*FunctionPtr)(T *, char **, uint32_t);
-        typedef void (*FunctionPtrMultiple)(char **, uint32_t, uint32_t, uint32_t);
+        typedef void (*FunctionPtr)(T *, char **, uint32_t, StringArena *);
+        typedef void (*FunctionPtrMultiple)(char **, uint32_t, uint32_t, uint32_t, StringArena *);
         FunctionPtr functionPtr;
         FunctionPtrMultiple functionPtrMultiple;
         T *resultData;
@@ -66,126 +210,962 @@ class LLVMEvaluator {
             functionPtr = nullptr;
             resultData = nullptr;
         }
-        const T *operator()(VarBlock *varBlock) {
+        const T *operator()(VarBlock *varBlock, StringArena &strings) {
             assert(functionPtr && resultData);
-            functionPtr(resultData, varBlock ? varBlock->data() : nullptr, varBlock ? varBlock->indirectIndex : 0);
+            functionPtr(resultData, varBlock ? varBlock->data() : nullptr, varBlock ? varBlock->indirectIndex : 0,
+                        &strings);
             return resultData;
         }
-        void operator()(VarBlock *varBlock, size_t outputVarBlockOffset, size_t rangeStart, size_t rangeEnd) {
+        void operator()(VarBlock *varBlock, size_t outputVarBlockOffset, size_t rangeStart, size_t rangeEnd,
+                        StringArena &strings) {
             assert(functionPtr && resultData);
-            functionPtrMultiple(varBlock ? varBlock->data() : nullptr, outputVarBlockOffset, rangeStart, rangeEnd);
+            functionPtrMultiple(varBlock ? varBlock->data() : nullptr, outputVarBlockOffset, rangeStart, rangeEnd,
+                                &strings);
+        }
+        //! Runs the loop function on the variable block pointers data
+        void callLoop(char **data, uint32_t outputVarBlockOffset, uint32_t rangeStart, uint32_t rangeEnd,
+                      StringArena &strings) {
+            functionPtrMultiple(data, outputVarBlockOffset, rangeStart, rangeEnd, &strings);
         }
     };
     std::unique_ptr<LLVMEvaluationContext<double>> _llvmEvalFP;
     std::unique_ptr<LLVMEvaluationContext<char *>> _llvmEvalStr;
+    // loop function of a group of expressions (see LLVMBatch::addGroup)
+    typedef void (*GroupFunctionPtr)(char **, const int32_t *, uint32_t, uint32_t, StringArena *);
+    GroupFunctionPtr _groupLoop = nullptr;
+    // strings the code builds, kept until the next evaluation (evaluations in parallel bring their own)
+    StringArena _strings;
+    //! A varying variable the code reads: its offset in the block, the bytes of a point's values and between points
+    struct Input {
+        int offset;
+        size_t valueBytes, strideBytes;
+    };
+    std::vector<Input> _inputs;
+    //! Dims of the outputs of a group's loop function and whether it computes in single precision
+    std::vector<int> _outputDims;
+    bool _singlePrecision = false;
+    //! Dense copies of scattered points' inputs and outputs, which the loop function runs on as points [0,n)
+    struct Gathered {
+        std::vector<char *> data;
+        std::vector<uint32_t> points;
+        std::vector<char> inputs, outputs;
+    };
+    //! Reused across chunks and calls (by every evaluator of the thread, parallel evaluations included)
+    static Gathered &gathered() {
+        static thread_local Gathered buffers;
+        return buffers;
+    }
+    //! Points gathered at a time, and runs of consecutive points shorter than this are gathered rather than run
+    static const uint32_t gatherChunk = 256, gatherRun = 16;
+    //! Regions of the gather buffers start aligned for any element type
+    static size_t gatherAligned(size_t bytes) { return (bytes + 15) / 16 * 16; }
+    // keeps the code alive: the JIT module it was compiled into (or nothing for precompiled code, which stays loaded)
+    std::shared_ptr<void> _code;
+    Expression::CompileTimings _timings;
+    // optimized IR of the code, kept while debugging
+    std::string _ir;
 
-    std::unique_ptr<llvm::LLVMContext> _llvmContext;
-    std::unique_ptr<llvm::ExecutionEngine> TheExecutionEngine;
+    template <class T>
+    void evalMultipleConverted(VarBlock *varBlock, uint32_t outputVarBlockOffset, const ChannelFormat &outputFormat,
+                               int dim, uint32_t rangeStart, uint32_t rangeEnd, StringArena &strings) {
+        Gathered &buffers = gathered();
+        size_t bytes = sizeof(T) * dim * gatherChunk;
+        if (buffers.outputs.size() < bytes) buffers.outputs.resize(bytes);
+        T *buffer = reinterpret_cast<T *>(buffers.outputs.data());
+        buffers.data.assign(varBlock->data(), varBlock->data() + varBlock->numVariables());
+        char *output = varBlock->data()[outputVarBlockOffset];
+        for (uint32_t start = rangeStart; start < rangeEnd; start += gatherChunk) {
+            uint32_t end = std::min(start + gatherChunk, rangeEnd);
+            // the loop function writes point i at output+dim*i
+            buffers.data[outputVarBlockOffset] = reinterpret_cast<char *>(reinterpret_cast<uintptr_t>(buffer) -
+                                                                          sizeof(T) * dim * static_cast<size_t>(start));
+            _llvmEvalFP->callLoop(buffers.data.data(), outputVarBlockOffset, start, end, strings);
+            storeChannel(outputFormat, output, start, end - start, dim, buffer, 1, dim);
+        }
+    }
+
+    //! Calls evalRange(runStart, runEnd) for every run of at least gatherRun consecutive points of indices (every run
+    //! if not gathering) and evalGathered(points, n) for chunks of the others
+    template <class R, class G>
+    static void forEachChunk(const uint32_t *indices, size_t numIndices, bool gathering, R evalRange, G evalGathered) {
+        std::vector<uint32_t> &points = gathered().points;
+        points.clear();
+        for (size_t i = 0; i < numIndices;) {
+            size_t runEnd = i + 1;
+            while (runEnd < numIndices && indices[runEnd] == indices[runEnd - 1] + 1) runEnd++;
+            if (!gathering || runEnd - i >= gatherRun) {
+                evalRange(indices[i], indices[runEnd - 1] + 1);
+            } else {
+                points.insert(points.end(), indices + i, indices + runEnd);
+                if (points.size() >= gatherChunk) {
+                    evalGathered(points.data(), static_cast<uint32_t>(points.size()));
+                    points.clear();
+                }
+            }
+            i = runEnd;
+        }
+        if (!points.empty()) evalGathered(points.data(), static_cast<uint32_t>(points.size()));
+    }
+
+    //! Whether the code evaluating scattered points into the outputs can run on gathered copies, which it can't
+    //! when it reads one of the outputs
+    bool canGather(const int *outputVarBlockOffsets, size_t numOutputs) const {
+        for (const Input &input : _inputs)
+            if (std::find(outputVarBlockOffsets, outputVarBlockOffsets + numOutputs, input.offset) !=
+                outputVarBlockOffsets + numOutputs)
+                return false;
+        return true;
+    }
+
+    //! Sets the gather buffers' data to the block's pointers, those of the inputs pointing at dense copies of the
+    //! n points' values, and makes room for outputBytes of output
+    void gather(VarBlock *varBlock, const uint32_t *points, uint32_t n, size_t outputBytes) const {
+        Gathered &buffers = gathered();
+        char **blockData = varBlock->data();
+        buffers.data.assign(blockData, blockData + varBlock->numVariables());
+        size_t bytes = 0;
+        for (const Input &input : _inputs) bytes += gatherAligned(input.strideBytes * n);
+        if (buffers.inputs.size() < bytes) buffers.inputs.resize(bytes);
+        if (buffers.outputs.size() < outputBytes) buffers.outputs.resize(outputBytes);
+        char *dense = buffers.inputs.data();
+        for (const Input &input : _inputs) {
+            const char *source = blockData[input.offset];
+            if (!source) continue;
+            for (uint32_t i = 0; i < n; i++)
+                memcpy(dense + input.strideBytes * i, source + input.strideBytes * points[i], input.valueBytes);
+            buffers.data[input.offset] = dense;
+            dense += gatherAligned(input.strideBytes * n);
+        }
+    }
 
   public:
     LLVMEvaluator() {}
 
-    const char *evalStr(VarBlock *varBlock) { return *(*_llvmEvalStr)(varBlock); }
-    const double *evalFP(VarBlock *varBlock) { return (*_llvmEvalFP)(varBlock); }
+    //! Evaluates one point. A string result stays valid until the expression is evaluated again.
+    const char *evalStr(VarBlock *varBlock) {
+        _strings.reset();
+        return *(*_llvmEvalStr)(varBlock, _strings);
+    }
+    const double *evalFP(VarBlock *varBlock) {
+        _strings.reset();
+        return (*_llvmEvalFP)(varBlock, _strings);
+    }
 
+    //! Evaluates the points [rangeStart,rangeEnd) into the output variable. The strings a string expression builds
+    //! stay valid until the expression is evaluated again.
     void evalMultiple(VarBlock *varBlock, uint32_t outputVarBlockOffset, uint32_t rangeStart, uint32_t rangeEnd) {
-        return (*_llvmEvalFP)(varBlock, outputVarBlockOffset, rangeStart, rangeEnd);
+        _strings.reset();
+        evalMultiple(varBlock, outputVarBlockOffset, rangeStart, rangeEnd, _strings);
+    }
+
+    //! evalMultiple adding the strings it builds to strings, e.g. one per thread evaluating parts of a range
+    void evalMultiple(VarBlock *varBlock, uint32_t outputVarBlockOffset, uint32_t rangeStart, uint32_t rangeEnd,
+                      StringArena &strings) {
+        if (_llvmEvalStr) return (*_llvmEvalStr)(varBlock, outputVarBlockOffset, rangeStart, rangeEnd, strings);
+        return (*_llvmEvalFP)(varBlock, outputVarBlockOffset, rangeStart, rangeEnd, strings);
+    }
+
+    //! evalMultiple into an output variable of the given (non native) format. The loop function writes natively, so
+    //! it runs a chunk of points at a time into a buffer (standing in for the output in a copy of the block's pointers)
+    //! whose values are then converted into the output.
+    void evalMultiple(VarBlock *varBlock, uint32_t outputVarBlockOffset, const ChannelFormat &outputFormat, int dim,
+                      bool singlePrecision, uint32_t rangeStart, uint32_t rangeEnd) {
+        _strings.reset();
+        evalMultiple(varBlock, outputVarBlockOffset, outputFormat, dim, singlePrecision, rangeStart, rangeEnd,
+                     _strings);
+    }
+
+    void evalMultiple(VarBlock *varBlock, uint32_t outputVarBlockOffset, const ChannelFormat &outputFormat, int dim,
+                      bool singlePrecision, uint32_t rangeStart, uint32_t rangeEnd, StringArena &strings) {
+        if (singlePrecision)
+            evalMultipleConverted<float>(varBlock, outputVarBlockOffset, outputFormat, dim, rangeStart, rangeEnd,
+                                         strings);
+        else
+            evalMultipleConverted<double>(varBlock, outputVarBlockOffset, outputFormat, dim, rangeStart, rangeEnd,
+                                          strings);
+    }
+
+    //! Evaluates the numIndices points listed in indices into the output variable (of the given format) through the
+    //! loop function: long runs of consecutive points in place, the other points a chunk at a time, gathered into
+    //! dense copies of the variables and scattered back from a dense output. The strings built for every chunk are
+    //! kept.
+    void evalIndexed(VarBlock *varBlock, uint32_t outputVarBlockOffset, const ChannelFormat &outputFormat, int dim,
+                     bool singlePrecision, const uint32_t *indices, size_t numIndices) {
+        _strings.reset();
+        int outputOffset = static_cast<int>(outputVarBlockOffset);
+        size_t elementSize = _llvmEvalStr ? sizeof(char *) : singlePrecision ? sizeof(float) : sizeof(double);
+        forEachChunk(indices, numIndices, canGather(&outputOffset, 1),
+                     [&](uint32_t runStart, uint32_t runEnd) {
+                         if (outputFormat.type == ChannelType::Native)
+                             evalMultiple(varBlock, outputVarBlockOffset, runStart, runEnd, _strings);
+                         else
+                             evalMultiple(varBlock, outputVarBlockOffset, outputFormat, dim, singlePrecision, runStart,
+                                          runEnd, _strings);
+                     },
+                     [&](const uint32_t *points, uint32_t n) {
+                         size_t pointBytes = elementSize * dim;
+                         gather(varBlock, points, n, pointBytes * n);
+                         Gathered &buffers = gathered();
+                         char *dense = buffers.outputs.data();
+                         buffers.data[outputVarBlockOffset] = dense;
+                         if (_llvmEvalStr)
+                             _llvmEvalStr->callLoop(buffers.data.data(), outputVarBlockOffset, 0, n, _strings);
+                         else
+                             _llvmEvalFP->callLoop(buffers.data.data(), outputVarBlockOffset, 0, n, _strings);
+                         char *output = varBlock->data()[outputVarBlockOffset];
+                         for (uint32_t i = 0; i < n; i++) {
+                             if (outputFormat.type == ChannelType::Native)
+                                 memcpy(output + pointBytes * points[i], dense + pointBytes * i, pointBytes);
+                             else if (singlePrecision)
+                                 storeChannel(outputFormat, output, points[i], 1, dim,
+                                              reinterpret_cast<const float *>(dense + pointBytes * i), 1, dim);
+                             else
+                                 storeChannel(outputFormat, output, points[i], 1, dim,
+                                              reinterpret_cast<const double *>(dense + pointBytes * i), 1, dim);
+                         }
+                     });
+    }
+
+    //! Evaluates the points [rangeStart,rangeEnd) of every expression of a group into the output variables at the
+    //! offsets (in the order the expressions were added)
+    void evalGroup(VarBlock *varBlock, const int *outputVarBlockOffsets, uint32_t rangeStart, uint32_t rangeEnd) {
+        assert(_groupLoop);
+        _strings.reset();
+        _groupLoop(varBlock->data(), outputVarBlockOffsets, rangeStart, rangeEnd, &_strings);
+    }
+
+    //! evalGroup for the numIndices points listed in indices, scattered points gathered like evalIndexed's
+    void evalGroupIndexed(VarBlock *varBlock, const int *outputVarBlockOffsets, const uint32_t *indices,
+                          size_t numIndices) {
+        assert(_groupLoop);
+        _strings.reset();
+        size_t elementSize = _singlePrecision ? sizeof(float) : sizeof(double);
+        forEachChunk(indices, numIndices, canGather(outputVarBlockOffsets, _outputDims.size()),
+                     [&](uint32_t runStart, uint32_t runEnd) {
+                         _groupLoop(varBlock->data(), outputVarBlockOffsets, runStart, runEnd, &_strings);
+                     },
+                     [&](const uint32_t *points, uint32_t n) {
+                         size_t outputBytes = 0;
+                         for (int dim : _outputDims) outputBytes += gatherAligned(elementSize * dim * n);
+                         gather(varBlock, points, n, outputBytes);
+                         Gathered &buffers = gathered();
+                         char *dense = buffers.outputs.data();
+                         for (size_t m = 0; m < _outputDims.size(); m++) {
+                             buffers.data[outputVarBlockOffsets[m]] = dense;
+                             dense += gatherAligned(elementSize * _outputDims[m] * n);
+                         }
+                         _groupLoop(buffers.data.data(), outputVarBlockOffsets, 0, n, &_strings);
+                         for (size_t m = 0; m < _outputDims.size(); m++) {
+                             size_t pointBytes = elementSize * _outputDims[m];
+                             const char *values = buffers.data[outputVarBlockOffsets[m]];
+                             char *output = varBlock->data()[outputVarBlockOffsets[m]];
+                             for (uint32_t i = 0; i < n; i++)
+                                 memcpy(output + pointBytes * points[i], values + pointBytes * i, pointBytes);
+                         }
+                     });
     }
 
-    void debugPrint() {
-        // TheModule->print(llvm::errs(), nullptr);
+    void debugPrint() { std::cerr << _ir; }
+
+    //! The optimized IR of the code, kept while Expression::debugging is on (empty for code loaded from the cache)
+    const std::string &ir() const { return _ir; }
+    void setIR(const std::string &ir) { _ir = ir; }
+
+  private:
+    void addInputs(const ExprNode *node, bool singlePrecision) {
+        if (const ExprVarNode *varNode = dynamic_cast<const ExprVarNode *>(node)) {
+            const VarBlockCreator::Ref *ref = dynamic_cast<const VarBlockCreator::Ref *>(varNode->var());
+            bool known = false;
+            for (const Input &input : _inputs) known = known || (ref && input.offset == (int)ref->offset());
+            if (ref && !known && !ref->type().isLifetimeUniform()) {
+                size_t elementSize = ref->format().type != ChannelType::Native ? channelTypeSize(ref->format().type)
+                                     : ref->type().isString() ? sizeof(char *)
+                                     : singlePrecision        ? sizeof(float)
+                                                              : sizeof(double);
+                int dim = ref->type().isString() ? 1 : ref->type().dim();
+                _inputs.push_back({(int)ref->offset(), elementSize * dim, elementSize * ref->stride()});
+            }
+        }
+        for (int i = 0; i < node->numChildren(); i++) addInputs(node->child(i), singlePrecision);
     }
 
-    bool prepLLVM(ExprNode *parseTree, ExprType desiredReturnType) {
+  public:
+
+    /// With singlePrecision the variable block holds float data and the loop function writes float outputs. This is
+    /// only a storage format: the generated code widens the data to double on load and computes in double.
+    bool prepLLVM(ExprNode *parseTree,
+                  ExprType desiredReturnType,
+                  bool singlePrecision = false,
+                  Expression::CompileProfile profile = Expression::FinalProfile);
+
+    //! How long compiling the code took
+    const Expression::CompileTimings &timings() const { return _timings; }
+    void setTimings(const Expression::CompileTimings &timings) { _timings = timings; }
+
+    //! Whether compiling succeeded (the functions were set by LLVMBatch::compile or Expression::loadPrecompiled's code)
+    bool prepared() const { return _llvmEvalFP || _llvmEvalStr || _groupLoop; }
+
+    //! Sets the compiled function and loop function of the expression
+    void init(const std::shared_ptr<void> &code, void *fp, void *fpLoop, bool desireFP, unsigned dim) {
+        _code = code;
+        if (desireFP) {
+            _llvmEvalFP.reset(new LLVMEvaluationContext<double>);
+            _llvmEvalFP->init(fp, fpLoop, dim);
+        } else {
+            _llvmEvalStr.reset(new LLVMEvaluationContext<char *>);
+            _llvmEvalStr->init(fp, fpLoop, dim);
+        }
+    }
+
+    //! Records the varying variables the code of an expression (or of each expression of a group, in order) reads
+    //! and the dim of its output, which evaluating scattered points gathers and scatters
+    void addExpression(const ExprNode *parseTree, const ExprType &desiredReturnType, bool singlePrecision) {
+        _singlePrecision = singlePrecision;
+        _outputDims.push_back(desiredReturnType.dim());
+        addInputs(parseTree, singlePrecision);
+    }
+
+    //! Sets the compiled loop function of a group
+    void initGroup(const std::shared_ptr<void> &code, void *fpGroupLoop) {
+        _code = code;
+        _groupLoop = reinterpret_cast<GroupFunctionPtr>(fpGroupLoop);
+    }
+};
+
+#ifdef SEEXPR_ENABLE_LLVM
+
+LLVM_VALUE promoteToDim(LLVM_VALUE val, unsigned dim, llvm::IRBuilder<> &Builder);
+
+//! Keeps the machine code of compiled modules in a directory, so that compiling them again (in any process) only
+//! loads it. A module's file is named by a hash of its key, which is stored at its start and compared when loading.
+class LLVMObjectCache : public llvm::ObjectCache {
+    struct Entry {
+        std::string key, path;
+        std::unique_ptr<llvm::MemoryBuffer> object;
+    };
+    std::string _directory;
+    //! By module identifier
+    std::map<std::string, Entry> _entries;
+
+  public:
+    explicit LLVMObjectCache(const std::string &directory) : _directory(directory) {}
+
+    //! Caches the machine code of the module named name under key, returns whether the directory had it
+    bool add(const std::string &name, const std::string &key) {
+        Entry &entry = _entries[name];
+        entry.key = key;
+        entry.path = _directory + "/" + codeHash(key) + ".o";
+        std::ifstream file(entry.path.c_str(), std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (contents.size() > key.size() && !contents.compare(0, key.size() + 1, key.c_str(), key.size() + 1))
+            entry.object = llvm::MemoryBuffer::getMemBufferCopy(contents.substr(key.size() + 1), entry.path);
+        return entry.object != nullptr;
+    }
+
+    std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module *module) override {
+        auto entry = _entries.find(module->getModuleIdentifier());
+        if (entry == _entries.end()) return nullptr;
+        return std::move(entry->second.object);
+    }
+
+    void notifyObjectCompiled(const llvm::Module *module, llvm::MemoryBufferRef object) override {
+        auto found = _entries.find(module->getModuleIdentifier());
+        if (found == _entries.end()) return;
+        const Entry &entry = found->second;
+        // written next to the entry and renamed, so concurrent compilations (in this process or others) never load
+        // a partial file
+        std::ostringstream temporary;
+#ifdef SEEXPR_WIN32
+        temporary << entry.path << "." << _getpid();
+#else
+        temporary << entry.path << "." << getpid();
+#endif
+        temporary << "." << std::setbase(16) << (uint64_t)(this) << ".tmp";
+        std::ofstream file(temporary.str().c_str(), std::ios::binary);
+        file.write(entry.key.c_str(), entry.key.size() + 1);
+        file.write(object.getBufferStart(), object.getBufferSize());
+        file.close();
+        if (file.fail() || std::rename(temporary.str().c_str(), entry.path.c_str()))
+            std::remove(temporary.str().c_str());
+    }
+};
+
+//! Context shared by the expressions compiled on one thread. LLVM contexts aren't thread safe, so everything using it
+//! (code generation and destroying compiled modules) holds its mutex.
+struct LLVMSharedContext {
+    std::mutex mutex;
+    llvm::LLVMContext context;
+    std::unique_ptr<llvm::Module> _noiseKernels;
+    bool _noiseKernelsParsed = false;
+
+    //! The calling thread's context (the native target is initialized once, with the first one)
+    static std::shared_ptr<LLVMSharedContext> forThread() {
+        static std::once_flag targetInitialized;
+        std::call_once(targetInitialized, []() {
+            llvm::InitializeNativeTarget();
+            llvm::InitializeNativeTargetAsmPrinter();
+            llvm::InitializeNativeTargetAsmParser();
+        });
+        thread_local std::shared_ptr<LLVMSharedContext> context(new LLVMSharedContext);
+        return context;
+    }
+
+    //! The noise builtins' bitcode, parsed the first time it's needed (null if the build has none or it doesn't parse)
+    const llvm::Module *noiseKernels() {
+        if (!_noiseKernelsParsed) {
+            _noiseKernelsParsed = true;
+#if (LLVM_VERSION_MAJOR >= 4)
+            if (SeExpr2NoiseKernelsSize) {
+                llvm::StringRef bitcode((const char *)SeExpr2NoiseKernels, SeExpr2NoiseKernelsSize);
+                auto module = llvm::parseBitcodeFile(llvm::MemoryBufferRef(bitcode, "SeExpr2NoiseKernels"), context);
+                if (module)
+                    _noiseKernels = std::move(*module);
+                else
+                    llvm::consumeError(module.takeError());
+            }
+#endif
+        }
+        return _noiseKernels.get();
+    }
+};
+
+//! The JIT engine holding the machine code of a batch of expressions, shared by their evaluators
+struct LLVMCompiledModule {
+    std::shared_ptr<LLVMSharedContext> context;
+    // declared before the engine, which uses it until destroyed
+    std::unique_ptr<LLVMObjectCache> cache;
+    std::unique_ptr<llvm::ExecutionEngine> engine;
+
+    ~LLVMCompiledModule() {
+        std::lock_guard<std::mutex> lock(context->mutex);
+        engine.reset();
+    }
+};
+
+//! Compiles expressions together: in the thread's shared context and one JIT engine for all of them, with a module per
+//! expression (or group) so that each one's machine code is cached on its own. The evaluators added get their
+//! functions when compile runs.
+class LLVMBatch {
+    struct Member {
+        LLVMEvaluator *evaluator;
+        ExprNode *parseTree;
+        ExprType desiredReturnType;
+        bool singlePrecision;
+        std::string key;
+        bool cacheable;
+        std::vector<const ExprFuncNode *> customFunctionCalls;
+    };
+    std::vector<Member> _members;
+    //! Expressions compiled into one loop function (the members' evaluators are unused)
+    struct Group {
+        LLVMEvaluator *evaluator;
+        std::vector<Member> members;
+    };
+    std::vector<Group> _groups;
+    std::map<std::string, void *> _standardFunctions;
+    Expression::CompileProfile _profile;
+    bool _precompiling;
+
+  public:
+    //! A batch for writeObject rather than compile is precompiling (its expressions don't use precompiled code)
+    explicit LLVMBatch(Expression::CompileProfile profile = Expression::FinalProfile, bool precompiling = false)
+        : _profile(profile), _precompiling(precompiling) {}
+    bool precompiling() const { return _precompiling; }
+
+    void add(LLVMEvaluator *evaluator, ExprNode *parseTree, ExprType desiredReturnType, bool singlePrecision) {
+        Member member{evaluator, parseTree, desiredReturnType, singlePrecision, "", true, {}};
+        member.key = codeKey(parseTree, desiredReturnType, singlePrecision, member.cacheable, _standardFunctions);
+        collectCustomFunctionCalls(parseTree, member.customFunctionCalls);
+        evaluator->addExpression(parseTree, desiredReturnType, singlePrecision);
+        _members.push_back(member);
+    }
+
+    //! Adds a group of fp expressions of one precision, given as their parse trees and desired return types, whose
+    //! loop function (see LLVMEvaluator::evalGroup) computes every one of them for a point before storing any result.
+    //! That leaves the optimizer free to share their variable loads and common subexpressions.
+    void addGroup(LLVMEvaluator *evaluator,
+                  const std::vector<std::pair<ExprNode *, ExprType>> &expressions,
+                  bool singlePrecision) {
+        Group group{evaluator, {}};
+        for (const std::pair<ExprNode *, ExprType> &expression : expressions) {
+            Member member{nullptr, expression.first, expression.second, singlePrecision, "", true, {}};
+            member.key = codeKey(member.parseTree, member.desiredReturnType, singlePrecision, member.cacheable,
+                                 _standardFunctions);
+            collectCustomFunctionCalls(member.parseTree, member.customFunctionCalls);
+            evaluator->addExpression(member.parseTree, member.desiredReturnType, singlePrecision);
+            group.members.push_back(member);
+        }
+        _groups.push_back(group);
+    }
+
+    //! Compiles the expressions added, returns false if the code of any of them failed to verify (the error is added
+    //! to its parse tree and its evaluator is left unprepared)
+    bool compile() {
         using namespace llvm;
-        InitializeNativeTarget();
-        InitializeNativeTargetAsmPrinter();
-        InitializeNativeTargetAsmParser();
+        if (_members.empty() && _groups.empty()) return true;
+        typedef std::chrono::steady_clock Clock;
+        Clock::time_point start = Clock::now();
+        std::shared_ptr<LLVMCompiledModule> compiled(new LLVMCompiledModule);
+        compiled->context = LLVMSharedContext::forThread();
+        std::lock_guard<std::mutex> lock(compiled->context->mutex);
 
-        std::string uniqueName = getUniqueName();
+        // every expression and group is a unit with a module named after its key (what its code depends on, with the
+        // compiler and target), so the machine code compiled before for it is found whatever it is batched with
+        std::vector<Unit> units;
+        for (const Member &member : _members) {
+            units.emplace_back(nullptr);
+            units.back().add(member);
+        }
+        for (const Group &group : _groups) {
+            units.emplace_back(&group);
+            for (const Member &member : group.members) units.back().add(member);
+        }
+        std::string prefix = std::string("SeExpr2 LLVM " LLVM_VERSION_STRING " ") + sys::getProcessTriple() + " " +
+                             targetDescription() + " profile " + std::to_string(_profile) + " inline " +
+                             std::to_string(ExprLocalFunctionNode::inlineLimit) + " noise kernels " +
+                             std::to_string(SeExpr2NoiseKernelsSize) + "\n";
+        std::string cacheDirectory = Expression::llvmCacheDirectory();
+        if (!cacheDirectory.empty()) compiled->cache.reset(new LLVMObjectCache(cacheDirectory));
 
-        // create Module
-        _llvmContext.reset(new LLVMContext());
+        std::set<std::string> names;
+        for (size_t u = 0; u < units.size(); u++) {
+            Unit &unit = units[u];
+            std::string key = prefix + unit.key;
+            unit.name = "SeExpr2JIT_" + codeHash(key);
+            // the same code twice in the batch is compiled again under a name of its own (and not cached)
+            bool cacheable = unit.cacheable && compiled->cache;
+            if (!names.insert(unit.name).second) {
+                unit.name += "_" + std::to_string(u);
+                cacheable = false;
+            }
+            unit.owned.reset(new Module(unit.name, compiled->context->context));
+            unit.module = unit.owned.get();
+            declareHelpers(unit.module);
+            if (cacheable) {
+                unit.cached = compiled->cache->add(unit.name, key);
+                Expression::countLLVMCacheLookup(unit.cached);
+            }
+            // cached code only needs the module to declare the functions it calls
+            if (unit.cached) continue;
 
-        std::unique_ptr<Module> TheModule(new Module(uniqueName + "_module", *_llvmContext));
+            size_t slot = 0;
+            for (const Member *member : unit.members)
+                for (const ExprFuncNode *call : member->customFunctionCalls)
+                    declareCustomFunctionSlot(unit.module, call, customFunctionSlot(unit.name, slot++));
+            if (unit.group) {
+                generateGroup(*unit.group, unit.name, unit.module, unit.functions);
+            } else {
+                Function *F = nullptr, *FLOOP = nullptr;
+                generate(*unit.members.front(), unit.name, unit.module, F, FLOOP);
+                unit.functions = {F, FLOOP};
+            }
 
-        // create all needed types
-        Type        *i8PtrTy        = Type::getInt8PtrTy(*_llvmContext);        // char *
-        PointerType *i8PtrPtrTy     = PointerType::getUnqual(i8PtrTy);          // char **
-        PointerType *i8PtrPtrPtrTy  = PointerType::getUnqual(i8PtrPtrTy);       // char ***
-        Type        *i32Ty          = Type::getInt32Ty(*_llvmContext);          // int
-        Type        *i32PtrTy       = Type::getInt32PtrTy(*_llvmContext);       // int *
-        Type        *i64Ty          = Type::getInt64Ty(*_llvmContext);          // int64 *
-        Type        *doublePtrTy    = Type::getDoublePtrTy(*_llvmContext);      // double *
-        PointerType *doublePtrPtrTy = PointerType::getUnqual(doublePtrTy);      // double **
-        Type        *voidTy         = Type::getVoidTy(*_llvmContext);           // void
+            // [verify]
+            std::string errorStr;
+            llvm::raw_string_ostream raw(errorStr);
+            bool broken = false;
+            for (Function *function : unit.functions) broken = llvm::verifyFunction(*function, &raw) || broken;
+            if (broken) {
+                unit.members.front()->parseTree->addError(ErrorCode::Unknown, {raw.str()});
+                unit.owned.reset();
+                unit.module = nullptr;
+                continue;
+            }
+            linkNoiseKernels(*compiled->context, unit.module);
 
-        // create bindings to helper functions for variables and fucntions
-        Function *SeExpr2LLVMEvalCustomFunctionFunc = nullptr;
-        Function *SeExpr2LLVMEvalFPVarRefFunc = nullptr;
-        Function *SeExpr2LLVMEvalStrVarRefFunc = nullptr;
-        Function *SeExpr2LLVMEvalstrlenFunc = nullptr;
-        Function *SeExpr2LLVMEvalmallocFunc = nullptr;
-        Function *SeExpr2LLVMEvalfreeFunc = nullptr;
-        Function *SeExpr2LLVMEvalmemsetFunc = nullptr;
-        Function *SeExpr2LLVMEvalstrcatFunc = nullptr;
-        {
-            {
-                FunctionType *FT = FunctionType::get(voidTy, {i32PtrTy, doublePtrTy, i8PtrPtrTy, i8PtrPtrTy, i64Ty}, false);
-                SeExpr2LLVMEvalCustomFunctionFunc = Function::Create(FT, GlobalValue::ExternalLinkage, "SeExpr2LLVMEvalCustomFunction", TheModule.get());
+            if (Expression::debugging) {
+                #ifdef DEBUG
+                std::cerr << "Pre verified LLVM byte code " << std::endl;
+                unit.module->print(llvm::errs(), nullptr);
+                #endif
+            }
+        }
+
+        Clock::time_point generatedIR = Clock::now();
+        for (Unit &unit : units) {
+            if (!unit.owned) continue;
+            if (!compiled->engine)
+                createExecutionEngine(*compiled, std::move(unit.owned));
+            else {
+                unit.module->setDataLayout(compiled->engine->getDataLayout());
+                compiled->engine->addModule(std::move(unit.owned));
             }
-            {
-                FunctionType *FT = FunctionType::get(voidTy, {i8PtrTy, doublePtrTy}, false);
-                SeExpr2LLVMEvalFPVarRefFunc = Function::Create(FT, GlobalValue::ExternalLinkage, "SeExpr2LLVMEvalFPVarRef", TheModule.get());
+        }
+        Clock::time_point createdEngine = Clock::now();
+
+        for (Unit &unit : units)
+            if (unit.module && !unit.cached) {
+                optimize(unit.module, unit.functions, compiled->engine->getTargetMachine());
+                if (Expression::debugging) {
+                    std::string ir;
+                    llvm::raw_string_ostream stream(ir);
+                    unit.module->print(stream, nullptr);
+                    if (unit.group)
+                        unit.group->evaluator->setIR(stream.str());
+                    else
+                        unit.members.front()->evaluator->setIR(stream.str());
+                }
             }
-            {
-                FunctionType *FT = FunctionType::get(voidTy, {i8PtrTy, i8PtrPtrTy}, false);
-                SeExpr2LLVMEvalStrVarRefFunc = Function::Create(FT, GlobalValue::ExternalLinkage, "SeExpr2LLVMEvalStrVarRef", TheModule.get());
+        Clock::time_point optimized = Clock::now();
+
+        // compiles the modules (writing them to the cache when there is one) and points the code's custom function
+        // calls at their nodes
+        if (compiled->engine) compiled->engine->finalizeObject();
+        bool good = true;
+        for (Unit &unit : units) {
+            if (!unit.module) {
+                good = false;
+                continue;
             }
-            {
-                FunctionType *FT = FunctionType::get(i32Ty, { i8PtrTy }, false);
-                SeExpr2LLVMEvalstrlenFunc = Function::Create(FT, Function::ExternalLinkage, "strlen", TheModule.get());
+            size_t slot = 0;
+            for (const Member *member : unit.members)
+                for (const ExprFuncNode *call : member->customFunctionCalls)
+                    if (uint64_t address =
+                            compiled->engine->getGlobalValueAddress(customFunctionSlot(unit.name, slot++)))
+                        *reinterpret_cast<uint64_t *>(address) = reinterpret_cast<uint64_t>(call);
+            if (unit.group) {
+                unit.group->evaluator->initGroup(
+                    compiled, (void *)compiled->engine->getFunctionAddress(unit.name + "_grouploop"));
+            } else {
+                const Member &member = *unit.members.front();
+                void *fp = (void *)compiled->engine->getFunctionAddress(unit.name + "_func");
+                void *fpLoop = (void *)compiled->engine->getFunctionAddress(unit.name + "_loopfunc");
+                const ExprType &type = member.desiredReturnType;
+                member.evaluator->init(compiled, fp, fpLoop, type.isFP(), (unsigned)type.dim());
             }
-            {
-                FunctionType *FT = FunctionType::get(i8PtrTy, { i32Ty }, false);
-                SeExpr2LLVMEvalmallocFunc = Function::Create(FT, Function::ExternalLinkage, "malloc", TheModule.get());
+        }
+
+        typedef std::chrono::duration<double> Seconds;
+        Expression::CompileTimings timings;
+        timings.irGeneration = Seconds(generatedIR - start).count();
+        timings.optimization = Seconds(optimized - createdEngine).count();
+        timings.codeGeneration = Seconds(createdEngine - generatedIR + (Clock::now() - optimized)).count();
+        for (const Member &member : _members) member.evaluator->setTimings(timings);
+        for (const Group &group : _groups) group.evaluator->setTimings(timings);
+        return good;
+    }
+
+    //! Writes the machine code of the expressions added to an object file for cpu (the host's if empty) instead of
+    //! compiling them in memory. Each expression's functions and key are named after precompiledSymbol(key) and the
+    //! functions outside the module are called through precompiledImport slots, which Expression::loadPrecompiled sets,
+    //! so loading the code needs neither LLVM nor this library's symbols. Returns false (appending why to error) if an
+    //! expression can't be precompiled or the file can't be written.
+    bool writeObject(const std::string &path, const std::string &cpu, std::string &error) {
+        using namespace llvm;
+        std::shared_ptr<LLVMSharedContext> context = LLVMSharedContext::forThread();
+        std::lock_guard<std::mutex> lock(context->mutex);
+        std::unique_ptr<Module> TheModule(new Module("SeExpr2_precompiled", context->context));
+        Module *altModule = TheModule.get();
+        declareHelpers(altModule);
+
+        // a generic cpu of the architecture unless another one (or the host's, "host") is asked for
+        std::string triple = sys::getProcessTriple();
+        const Target *target = TargetRegistry::lookupTarget(triple, error);
+        if (!target) return false;
+        bool host = cpu == "host";
+        std::string cpuName = host ? sys::getHostCPUName().str() : cpu.empty() ? "generic" : cpu, features;
+        if (host)
+            for (const std::string &feature : targetFeatures()) features += (features.empty() ? "" : ",") + feature;
+        std::unique_ptr<TargetMachine> targetMachine(
+            target->createTargetMachine(triple, cpuName, features, targetOptions(), Reloc::PIC_));
+        // the library's keys end with the target, which bindPrecompiled checks the host runs
+        std::string targetKey = precompiledTarget(cpuName, features, requiredLevel(targetMachine.get()));
+
+        std::vector<Function *> functions;
+        std::set<std::string> written;
+        for (const Member &member : _members) {
+            std::string name = precompiledSymbol(member.key);
+            if (!member.cacheable || !member.customFunctionCalls.empty()) {
+                error += "'" + member.parseTree->expr()->getExpr() +
+                         "' uses host variables or custom functions, which can't be precompiled\n";
+                continue;
             }
-            {
-                FunctionType *FT = FunctionType::get(voidTy, { i8PtrTy }, false);
-                SeExpr2LLVMEvalfreeFunc = Function::Create(FT, Function::ExternalLinkage, "free", TheModule.get());
+            if (!written.insert(name).second) continue;
+            Function *F = nullptr, *FLOOP = nullptr;
+            generate(member, name, altModule, F, FLOOP);
+            std::string errorStr;
+            llvm::raw_string_ostream raw(errorStr);
+            if (llvm::verifyFunction(*F, &raw) || llvm::verifyFunction(*FLOOP, &raw)) {
+                error += raw.str();
+                continue;
             }
-            {
-                FunctionType *FT = FunctionType::get(voidTy, { i8PtrTy, i32Ty, i32Ty }, false);
-                SeExpr2LLVMEvalmemsetFunc = Function::Create(FT, Function::ExternalLinkage, "memset", TheModule.get());
+            functions.push_back(F);
+            functions.push_back(FLOOP);
+            Constant *key = ConstantDataArray::getString(context->context, member.key + targetKey);
+            new GlobalVariable(*altModule, key->getType(), true, GlobalValue::ExternalLinkage, key, name + "_key");
+        }
+        if (!error.empty()) return false;
+        linkNoiseKernels(*context, altModule);
+
+        altModule->setDataLayout(targetMachine->createDataLayout());
+        altModule->setTargetTriple(triple);
+        importThroughSlots(altModule);
+        optimize(altModule, functions, targetMachine.get());
+
+        SmallVector<char, 0> object;
+        raw_svector_ostream stream(object);
+        legacy::PassManager emitter;
+#if (LLVM_VERSION_MAJOR >= 10)
+        bool unsupported = targetMachine->addPassesToEmitFile(emitter, stream, nullptr, CGFT_ObjectFile);
+#elif (LLVM_VERSION_MAJOR >= 7)
+        bool unsupported = targetMachine->addPassesToEmitFile(emitter, stream, nullptr, TargetMachine::CGFT_ObjectFile);
+#else
+        bool unsupported = targetMachine->addPassesToEmitFile(emitter, stream, TargetMachine::CGFT_ObjectFile);
+#endif
+        if (unsupported) {
+            error += "can't write object files for " + triple + "\n";
+            return false;
+        }
+        emitter.run(*altModule);
+        std::ofstream file(path.c_str(), std::ios::binary);
+        file.write(object.data(), object.size());
+        file.close();
+        if (file.fail()) {
+            error += "can't write " + path + "\n";
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    //! Runs the optimization passes of the profile (the function pass manager on functions, the expressions'
+    //! functions, and the module pass manager on the module) tuned with the target's cost model
+    void optimize(llvm::Module *module,
+                  const std::vector<llvm::Function *> &functions,
+                  llvm::TargetMachine *targetMachine) const {
+        using namespace llvm;
+        bool final = _profile == Expression::FinalProfile;
+        llvm::PassManagerBuilder builder;
+        std::unique_ptr<llvm::legacy::PassManager> pm(new llvm::legacy::PassManager);
+        std::unique_ptr<llvm::legacy::FunctionPassManager> fpm(new llvm::legacy::FunctionPassManager(module));
+        builder.OptLevel = final ? 3 : 1;
+#if (LLVM_VERSION_MAJOR >= 4)
+        builder.Inliner = llvm::createAlwaysInlinerLegacyPass();
+#else
+        builder.Inliner = llvm::createAlwaysInlinerPass();
+#endif
+        // the loop function's point loop is vectorized for the target's vector width (the vectorizer adds the
+        // scalar loop for the remaining points), which needs the target's cost model
+        builder.LoopVectorize = final;
+        builder.SLPVectorize = final;
+        if (targetMachine) {
+            pm->add(createTargetTransformInfoWrapperPass(targetMachine->getTargetIRAnalysis()));
+            fpm->add(createTargetTransformInfoWrapperPass(targetMachine->getTargetIRAnalysis()));
+        }
+        builder.populateModulePassManager(*pm);
+        // fpm->add(new llvm::DataLayoutPass());
+        builder.populateFunctionPassManager(*fpm);
+        for (Function *function : functions) fpm->run(*function);
+        pm->run(*module);
+    }
+
+    //! Makes the calls to the standard functions and helpers declared in the module load the callee from an exported
+    //! slot named precompiledImport(callee), which whoever loads the code sets
+    static void importThroughSlots(llvm::Module *module) {
+        using namespace llvm;
+        std::vector<Function *> imported;
+        for (Function &function : *module)
+            if (function.isDeclaration() && !function.isIntrinsic() && !function.use_empty() &&
+                function.getName().startswith("SeExpr2"))
+                imported.push_back(&function);
+        for (Function *function : imported) {
+            GlobalVariable *slot = new GlobalVariable(*module, function->getType(), false,
+                                                      GlobalValue::ExternalLinkage,
+                                                      ConstantPointerNull::get(function->getType()),
+                                                      precompiledImport(function->getName().str()));
+            std::vector<CallInst *> calls;
+            for (User *user : function->users())
+                if (CallInst *call = dyn_cast<CallInst>(user)) calls.push_back(call);
+            for (CallInst *call : calls) {
+                IRBuilder<> Builder(call);
+                LoadInst *callee = Builder.CreateLoad(function->getType(), slot);
+                // the slot doesn't change while the code runs, so its loads are hoisted out of the point loop
+                callee->setMetadata(LLVMContext::MD_invariant_load, MDNode::get(module->getContext(), llvm::None));
+                call->setCalledFunction(function->getFunctionType(), callee);
             }
-            {
-                FunctionType *FT = FunctionType::get(i8PtrTy, { i8PtrTy, i8PtrTy }, false);
-                SeExpr2LLVMEvalstrcatFunc = Function::Create(FT, Function::ExternalLinkage, "strcat", TheModule.get());
+        }
+    }
+
+  public:
+    //! The host's CPU features in the form the code generators take them, with the ones above the instruction set
+    //! level selected for the library's kernels turned off, so that SE_EXPR_ISA (see CPUDispatch.h) caps both
+    static std::vector<std::string> targetFeatures() {
+        llvm::StringMap<bool> hostFeatures;
+        std::vector<std::string> features;
+        if (llvm::sys::getHostCPUFeatures(hostFeatures))
+            for (auto &feature : hostFeatures) {
+                std::string name = feature.first().str();
+                bool enabled = feature.second && featureLevel(name) <= selectedISALevel();
+                features.push_back((enabled ? "+" : "-") + name);
             }
+        std::sort(features.begin(), features.end());
+        return features;
+    }
+
+    //! Options of the code generators: multiplies and adds are never fused, like in the library's own code (built
+    //! with -ffp-contract=off), so compiled expressions compute what the interpreter does
+    static llvm::TargetOptions targetOptions() {
+        llvm::TargetOptions options;
+        options.AllowFPOpFusion = llvm::FPOpFusion::Strict;
+        return options;
+    }
+
+    //! The cpu and the features that are on, which the final profile generates code for
+    static std::string targetDescription() {
+        std::string description = llvm::sys::getHostCPUName().str();
+        for (const std::string &feature : targetFeatures())
+            if (feature[0] == '+') description += " " + feature.substr(1);
+        return description;
+    }
+
+  private:
+    //! Instruction set level a vector feature belongs to
+    static ISALevel featureLevel(const std::string &feature) {
+        if (!feature.compare(0, 6, "avx512")) return ISAAVX512;
+        if (!feature.compare(0, 3, "avx") || feature == "fma" || feature == "f16c") return ISAAVX2;
+#ifndef __SSE4_1__
+        if (!feature.compare(0, 4, "sse4")) return ISASSE41;
+#endif
+        return ISABaseline;
+    }
+
+    //! Instruction set level a cpu needs at least to run the code targetMachine generates
+    static ISALevel requiredLevel(llvm::TargetMachine *targetMachine) {
+        ISALevel level = ISABaseline;
+        const llvm::Triple &triple = targetMachine->getTargetTriple();
+        if (triple.getArch() != llvm::Triple::x86 && triple.getArch() != llvm::Triple::x86_64) return level;
+        const llvm::MCSubtargetInfo *info = targetMachine->getMCSubtargetInfo();
+        for (const char *feature :
+             {"sse4.1", "sse4.2", "avx", "avx2", "fma", "f16c", "avx512f", "avx512dq", "avx512vl", "avx512bw"})
+            if (info->checkFeatures(std::string("+") + feature)) level = std::max(level, featureLevel(feature));
+        return level;
+    }
+
+    //! An expression or group compiled into a module of its own
+    struct Unit {
+        explicit Unit(const Group *group) : key(group ? "group\n" : ""), group(group) {}
+        void add(const Member &member) {
+            key += member.key;
+            cacheable = cacheable && member.cacheable;
+            members.push_back(&member);
         }
 
+        std::string key;
+        bool cacheable = true;
+        std::vector<const Member *> members;
+        const Group *group;
+        //! Names the module and prefixes the names of its functions
+        std::string name;
+        bool cached = false;
+        std::unique_ptr<llvm::Module> owned;
+        //! Null if the code failed to verify
+        llvm::Module *module = nullptr;
+        std::vector<llvm::Function *> functions;
+    };
+
+    //! Name of the slot of a unit's k-th custom function call (see collectCustomFunctionCalls)
+    static std::string customFunctionSlot(const std::string &unitName, size_t k) {
+        return unitName + "_node" + std::to_string(k);
+    }
+
+    // create bindings to helper functions for variables and fucntions
+    static void declareHelpers(llvm::Module *TheModule) {
+        using namespace llvm;
+        LLVMContext &context = TheModule->getContext();
+        Type *i8PtrTy = Type::getInt8PtrTy(context);
+        Type *i8PtrPtrTy = PointerType::getUnqual(i8PtrTy);
+        Type *i32PtrTy = Type::getInt32PtrTy(context);
+        Type *i64Ty = Type::getInt64Ty(context);
+        Type *doublePtrTy = Type::getDoublePtrTy(context);
+        Type *voidTy = Type::getVoidTy(context);
+        {
+            FunctionType *FT = FunctionType::get(voidTy, {i32PtrTy, doublePtrTy, i8PtrPtrTy, i8PtrPtrTy, i64Ty}, false);
+            Function::Create(FT, GlobalValue::ExternalLinkage, "SeExpr2LLVMEvalCustomFunction", TheModule);
+        }
+        {
+            FunctionType *FT = FunctionType::get(voidTy, {i8PtrTy, doublePtrTy}, false);
+            Function::Create(FT, GlobalValue::ExternalLinkage, "SeExpr2LLVMEvalFPVarRef", TheModule);
+        }
+        {
+            FunctionType *FT = FunctionType::get(voidTy, {i8PtrTy, i8PtrPtrTy}, false);
+            Function::Create(FT, GlobalValue::ExternalLinkage, "SeExpr2LLVMEvalStrVarRef", TheModule);
+        }
+        {
+            FunctionType *FT = FunctionType::get(i8PtrTy, {i8PtrTy, i8PtrTy, i8PtrTy}, false);
+            Function::Create(FT, Function::ExternalLinkage, "SeExpr2LLVMEvalStrConcat", TheModule);
+        }
+        {
+            FunctionType *FT = FunctionType::get(Type::getInt32Ty(context), {i8PtrTy, i8PtrTy}, false);
+            Function::Create(FT, Function::ExternalLinkage, "SeExpr2LLVMEvalStrEqual", TheModule);
+        }
+    }
+
+    //! Generates uniqueName_func evaluating one point of the member's expression and uniqueName_loopfunc evaluating a
+    //! range of points into an output variable. Both take the StringArena the strings they build go to last.
+    static void generate(const Member &member,
+                         const std::string &uniqueName,
+                         llvm::Module *TheModule,
+                         llvm::Function *&F,
+                         llvm::Function *&FLOOP) {
+        using namespace llvm;
+        LLVMContext *_llvmContext = &TheModule->getContext();
+        ExprNode *parseTree = member.parseTree;
+        ExprType desiredReturnType = member.desiredReturnType;
+        bool singlePrecision = member.singlePrecision;
+
+        // create all needed types
+        Type        *i8PtrTy        = Type::getInt8PtrTy(*_llvmContext);        // char *
+        PointerType *i8PtrPtrTy     = PointerType::getUnqual(i8PtrTy);          // char **
+        PointerType *i8PtrPtrPtrTy  = PointerType::getUnqual(i8PtrPtrTy);       // char ***
+        Type        *i32Ty          = Type::getInt32Ty(*_llvmContext);          // int
+        Type        *doublePtrTy    = Type::getDoublePtrTy(*_llvmContext);      // double *
+        PointerType *doublePtrPtrTy = PointerType::getUnqual(doublePtrTy);      // double **
+        Type        *floatPtrTy     = Type::getFloatPtrTy(*_llvmContext);       // float *
+        PointerType *floatPtrPtrTy  = PointerType::getUnqual(floatPtrTy);       // float **
+        // the variable block pointers as seen by the generated code (VarCodeGeneration loads by their element type)
+        PointerType *dataPtrPtrTy   = singlePrecision ? floatPtrPtrTy : doublePtrPtrTy;
+        PointerType *outputPtrPtrTy = singlePrecision ? floatPtrPtrTy : doublePtrPtrTy;
+        Type        *voidTy         = Type::getVoidTy(*_llvmContext);           // void
+
         // create function and entry BB
         bool desireFP = desiredReturnType.isFP();
+        unsigned int dimDesired = (unsigned)desiredReturnType.dim();
         Type *ParamTys[] = {
             desireFP ? doublePtrTy : i8PtrPtrTy,
-            doublePtrPtrTy,
-            i32Ty
+            dataPtrPtrTy,
+            i32Ty,
+            i8PtrTy
         };
         FunctionType *FT = FunctionType::get(voidTy, ParamTys, false);
-        Function *F = Function::Create(FT, Function::ExternalLinkage, uniqueName + "_func", TheModule.get());
+        F = Function::Create(FT, Function::ExternalLinkage, uniqueName + "_func", TheModule);
 #if LLVM_VERSION_MAJOR > 4
         F->addAttribute(llvm::AttributeList::FunctionIndex, llvm::Attribute::AlwaysInline);
 #else
         F->addAttribute(llvm::AttributeSet::FunctionIndex, llvm::Attribute::AlwaysInline);
+#endif
+        // The result never overlaps the variable data, which lets the uniform part of F (uniform variable loads and
+        // the math on them) be hoisted out of the loop function once F is inlined there
+#if LLVM_VERSION_MAJOR > 4
+        F->addParamAttr(0, llvm::Attribute::NoAlias);
+#else
+        F->addAttribute(1, llvm::Attribute::NoAlias);
+#endif
+        // Nor do the result stores change the variable block's pointers, so once inlined their loads are hoisted out
+        // of the point loop and the variables are read with contiguous (vectorizable) loads
+#if LLVM_VERSION_MAJOR > 4
+        F->addParamAttr(1, llvm::Attribute::NoAlias);
+        F->addParamAttr(1, llvm::Attribute::ReadOnly);
+#else
+        F->addAttribute(2, llvm::Attribute::NoAlias);
+        F->addAttribute(2, llvm::Attribute::ReadOnly);
 #endif
         {
             // label the function with names
-            const char *names[] = {"outputPointer", "dataBlock", "indirectIndex"};
+            const char *names[] = {"outputPointer", "dataBlock", "indirectIndex", "stringArena"};
             int idx = 0;
             for (auto &arg : F->args()) arg.setName(names[idx++]);
         }
 
-        unsigned int dimDesired = (unsigned)desiredReturnType.dim();
         unsigned int dimGenerated = parseTree->type().dim();
         {
             BasicBlock *BB = BasicBlock::Create(*_llvmContext, "entry", F);
@@ -221,12 +1201,47 @@ class LLVMEvaluator {
             Builder.CreateRetVoid();
         }
 
+        // In single precision the loop calls F through uniqueName_narrowfunc, which narrows F's results into the float
+        // output. Like F it is external (so its pointer arguments aren't promoted to loads in the loop) and its output
+        // is noalias, so once both are inlined the narrowing stores still don't keep the variable loads in the loop.
+        Function *FPOINT = F;
+        if (desireFP && singlePrecision) {
+            Type *doubleTy = Type::getDoubleTy(*_llvmContext), *floatTy = Type::getFloatTy(*_llvmContext);
+            FunctionType *FTNARROW = FunctionType::get(voidTy, {floatPtrTy, dataPtrPtrTy, i32Ty, i8PtrTy}, false);
+            FPOINT = Function::Create(FTNARROW, Function::ExternalLinkage, uniqueName + "_narrowfunc", TheModule);
+#if LLVM_VERSION_MAJOR > 4
+            FPOINT->addAttribute(llvm::AttributeList::FunctionIndex, llvm::Attribute::AlwaysInline);
+            FPOINT->addParamAttr(0, llvm::Attribute::NoAlias);
+            FPOINT->addParamAttr(1, llvm::Attribute::NoAlias);
+            FPOINT->addParamAttr(1, llvm::Attribute::ReadOnly);
+#else
+            FPOINT->addAttribute(llvm::AttributeSet::FunctionIndex, llvm::Attribute::AlwaysInline);
+            FPOINT->addAttribute(1, llvm::Attribute::NoAlias);
+            FPOINT->addAttribute(2, llvm::Attribute::NoAlias);
+            FPOINT->addAttribute(2, llvm::Attribute::ReadOnly);
+#endif
+            IRBuilder<> Builder(BasicBlock::Create(*_llvmContext, "entry", FPOINT));
+            Function::arg_iterator arg = FPOINT->arg_begin();
+            Value *outputArg = &*arg++;
+            Value *dataBlockArg = &*arg++;
+            Value *indirectIndexArg = &*arg++;
+            Value *stringArenaArg = &*arg++;
+            Value *resultVar = Builder.CreateAlloca(doubleTy, ConstantInt::get(i32Ty, dimDesired), "resultVar");
+            Builder.CreateCall(F, {resultVar, dataBlockArg, indirectIndexArg, stringArenaArg});
+            for (unsigned i = 0; i < dimDesired; ++i) {
+                Value *result = Builder.CreateLoad(doubleTy, Builder.CreateConstInBoundsGEP1_32(doubleTy, resultVar, i));
+                Builder.CreateStore(Builder.CreateFPTrunc(result, floatTy),
+                                    Builder.CreateConstInBoundsGEP1_32(floatTy, outputArg, i));
+            }
+            Builder.CreateRetVoid();
+        }
+
         // write a new function
-        FunctionType *FTLOOP = FunctionType::get(voidTy, {i8PtrTy, i32Ty, i32Ty, i32Ty}, false);
-        Function *FLOOP = Function::Create(FTLOOP, Function::ExternalLinkage, uniqueName + "_loopfunc", TheModule.get());
+        FunctionType *FTLOOP = FunctionType::get(voidTy, {i8PtrTy, i32Ty, i32Ty, i32Ty, i8PtrTy}, false);
+        FLOOP = Function::Create(FTLOOP, Function::ExternalLinkage, uniqueName + "_loopfunc", TheModule);
         {
             // label the function with names
-            const char *names[] = {"dataBlock", "outputVarBlockOffset", "rangeStart", "rangeEnd"};
+            const char *names[] = {"dataBlock", "outputVarBlockOffset", "rangeStart", "rangeEnd", "stringArena"};
             int idx = 0;
             for (auto &arg : FLOOP->args()) {
                 arg.setName(names[idx++]);
@@ -252,23 +1267,25 @@ class LLVMEvaluator {
             Value *outputVarBlockOffsetArg = &*argIterator;     ++argIterator;
             Value *rangeStartArg = &*argIterator;                ++argIterator;
             Value *rangeEndArg = &*argIterator;                    ++argIterator;
+            Value *stringArenaArg = &*argIterator;                 ++argIterator;
 
             // Allocate Variables
             Value *rangeStartVar = Builder.CreateAlloca(Type::getInt32Ty(*_llvmContext), oneValue, "rangeStartVar");
             Value *rangeEndVar = Builder.CreateAlloca(Type::getInt32Ty(*_llvmContext), oneValue, "rangeEndVar");
             Value *indexVar = Builder.CreateAlloca(Type::getInt32Ty(*_llvmContext), oneValue, "indexVar");
             Value *outputVarBlockOffsetVar = Builder.CreateAlloca(Type::getInt32Ty(*_llvmContext), oneValue, "outputVarBlockOffsetVar");
-            Value *varBlockDoublePtrPtrVar = Builder.CreateAlloca(doublePtrPtrTy, oneValue, "varBlockDoublePtrPtrVar");
-            Value *varBlockTPtrPtrVar = Builder.CreateAlloca(desireFP == true ? doublePtrPtrTy : i8PtrPtrPtrTy, oneValue, "varBlockTPtrPtrVar");
+            Value *varBlockDoublePtrPtrVar = Builder.CreateAlloca(dataPtrPtrTy, oneValue, "varBlockDoublePtrPtrVar");
+            Value *varBlockTPtrPtrVar = Builder.CreateAlloca(desireFP == true ? outputPtrPtrTy : i8PtrPtrPtrTy, oneValue, "varBlockTPtrPtrVar");
 
             // Copy variables from args
-            Builder.CreateStore(Builder.CreatePointerCast(varBlockCharPtrPtrArg, doublePtrPtrTy, "varBlockAsDoublePtrPtr"), varBlockDoublePtrPtrVar);
-            Builder.CreateStore(Builder.CreatePointerCast(varBlockCharPtrPtrArg, desireFP ? doublePtrPtrTy : i8PtrPtrPtrTy, "varBlockAsTPtrPtr"), varBlockTPtrPtrVar);
+            Builder.CreateStore(Builder.CreatePointerCast(varBlockCharPtrPtrArg, dataPtrPtrTy, "varBlockAsDoublePtrPtr"), varBlockDoublePtrPtrVar);
+            Builder.CreateStore(Builder.CreatePointerCast(varBlockCharPtrPtrArg, desireFP ? outputPtrPtrTy : i8PtrPtrPtrTy, "varBlockAsTPtrPtr"), varBlockTPtrPtrVar);
             Builder.CreateStore(rangeStartArg, rangeStartVar);
             Builder.CreateStore(rangeEndArg, rangeEndVar);
             Builder.CreateStore(outputVarBlockOffsetArg, outputVarBlockOffsetVar);
 
-            // Set output pointer
+            // Set output pointer (to doubles, floats in single precision, or strings)
+            Type *outputElementTy = !desireFP ? i8PtrTy : singlePrecision ? Type::getFloatTy(*_llvmContext) : Type::getDoubleTy(*_llvmContext);
             Value *outputBasePtrPtr = Builder.CreateGEP(nullptr, Builder.CreateLoad(varBlockTPtrPtrVar), outputVarBlockOffsetArg, "outputBasePtrPtr");
             Value *outputBasePtr = Builder.CreateLoad(outputBasePtrPtr, "outputBasePtr");
             Builder.CreateStore(Builder.CreateLoad(rangeStartVar), indexVar);
@@ -279,131 +1296,222 @@ class LLVMEvaluator {
             Builder.CreateCondBr(cond, loopRepeatBlock, loopEndBlock);
 
             Builder.SetInsertPoint(loopRepeatBlock);
-            Value *myOutputPtr = Builder.CreateGEP(nullptr, outputBasePtr, Builder.CreateMul(dimValue, Builder.CreateLoad(indexVar)));
-            Builder.CreateCall(F, {myOutputPtr, Builder.CreateLoad(varBlockDoublePtrPtrVar), Builder.CreateLoad(indexVar)});
+            // indices never wrap, which lets the vectorizer see the accesses as strided
+            Value *myOutputPtr = Builder.CreateGEP(outputElementTy, outputBasePtr, Builder.CreateMul(dimValue, Builder.CreateLoad(i32Ty, indexVar), "", true, true));
+            Builder.CreateCall(FPOINT, {myOutputPtr, Builder.CreateLoad(dataPtrPtrTy, varBlockDoublePtrPtrVar), Builder.CreateLoad(i32Ty, indexVar), stringArenaArg});
 
             Builder.CreateBr(loopIncBlock);
 
             Builder.SetInsertPoint(loopIncBlock);
-            Builder.CreateStore(Builder.CreateAdd(Builder.CreateLoad(indexVar), oneValue), indexVar);
+            Builder.CreateStore(Builder.CreateAdd(Builder.CreateLoad(i32Ty, indexVar), oneValue, "", true, true), indexVar);
             Builder.CreateBr(loopCmpBlock);
 
             Builder.SetInsertPoint(loopEndBlock);
             Builder.CreateRetVoid();
         }
+    }
+
+    //! Generates uniqueName_grouploop evaluating a range of points of every member of the group into the output
+    //! variables at the offsets it is passed, appending it and the member functions it calls to functions. Every
+    //! point computes all members into temporaries before the results are stored, so once the member functions are
+    //! inlined no store separates their loads and the optimizer merges what they compute alike.
+    static void generateGroup(const Group &group,
+                              const std::string &uniqueName,
+                              llvm::Module *TheModule,
+                              std::vector<llvm::Function *> &functions) {
+        using namespace llvm;
+        LLVMContext &context = TheModule->getContext();
+        bool singlePrecision = group.members.front().singlePrecision;
+        Type *i32Ty = Type::getInt32Ty(context);
+        Type *doubleTy = Type::getDoubleTy(context);
+        Type *outputTy = singlePrecision ? Type::getFloatTy(context) : doubleTy;
+        Type *outputPtrTy = PointerType::getUnqual(outputTy);
+        Type *dataPtrPtrTy =
+            PointerType::getUnqual(singlePrecision ? Type::getFloatPtrTy(context) : Type::getDoublePtrTy(context));
 
-        if (Expression::debugging) {
-            #ifdef DEBUG
-            std::cerr << "Pre verified LLVM byte code " << std::endl;
-            TheModule->print(llvm::errs(), nullptr);
-            #endif
+        std::vector<Function *> memberFunctions;
+        for (size_t m = 0; m < group.members.size(); m++) {
+            Function *F = nullptr, *FLOOP = nullptr;
+            generate(group.members[m], uniqueName + "_" + std::to_string(m), TheModule, F, FLOOP);
+            FLOOP->eraseFromParent();
+            memberFunctions.push_back(F);
         }
 
-        // TODO: Find out if there is a new way to veirfy
-        // if (verifyModule(*TheModule)) {
-        //     std::cerr << "Logic error in code generation of LLVM alert developers" << std::endl;
-        //     TheModule->print(llvm::errs(), nullptr);
-        // }
-        Module *altModule = TheModule.get();
-        std::string ErrStr;
-        TheExecutionEngine.reset(EngineBuilder(std::move(TheModule))
-                                     .setErrorStr(&ErrStr)
-                                 //     .setUseMCJIT(true)
-                                     .setOptLevel(CodeGenOpt::Aggressive)
-                                     .create());
+        Type *ParamTys[] = {Type::getInt8PtrTy(context), PointerType::getUnqual(i32Ty), i32Ty, i32Ty,
+                            Type::getInt8PtrTy(context)};
+        FunctionType *FT = FunctionType::get(Type::getVoidTy(context), ParamTys, false);
+        Function *FGROUP = Function::Create(FT, Function::ExternalLinkage, uniqueName + "_grouploop", TheModule);
+        const char *names[] = {"dataBlock", "outputVarBlockOffsets", "rangeStart", "rangeEnd", "stringArena"};
+        std::vector<Value *> args;
+        for (auto &arg : FGROUP->args()) {
+            arg.setName(names[args.size()]);
+            args.push_back(&arg);
+        }
 
-        altModule->setDataLayout(TheExecutionEngine->getDataLayout());
+        BasicBlock *entryBlock = BasicBlock::Create(context, "entry", FGROUP);
+        BasicBlock *loopBlock = BasicBlock::Create(context, "loop", FGROUP);
+        BasicBlock *loopEndBlock = BasicBlock::Create(context, "loopEnd", FGROUP);
+        IRBuilder<> Builder(entryBlock);
+        Value *data = Builder.CreatePointerCast(args[0], dataPtrPtrTy, "varBlockData");
+        Value *outputPtrs = Builder.CreatePointerCast(args[0], PointerType::getUnqual(outputPtrTy), "varBlockOutputs");
+        std::vector<Value *> outputBases, results;
+        for (size_t m = 0; m < group.members.size(); m++) {
+            unsigned dim = (unsigned)group.members[m].desiredReturnType.dim();
+            Value *offset = Builder.CreateLoad(i32Ty, Builder.CreateConstInBoundsGEP1_32(i32Ty, args[1], m));
+            Value *outputPtr = Builder.CreateInBoundsGEP(outputPtrTy, outputPtrs, offset);
+            outputBases.push_back(Builder.CreateLoad(outputPtrTy, outputPtr, "outputBasePtr"));
+            results.push_back(Builder.CreateAlloca(doubleTy, ConstantInt::get(i32Ty, dim), "result"));
+        }
+        Builder.CreateCondBr(Builder.CreateICmpULT(args[2], args[3]), loopBlock, loopEndBlock);
 
-        // Add bindings to C linkage helper functions
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalFPVarRefFunc, (void *)SeExpr2LLVMEvalFPVarRef);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalStrVarRefFunc, (void *)SeExpr2LLVMEvalStrVarRef);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalCustomFunctionFunc, (void *)SeExpr2LLVMEvalCustomFunction);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalstrlenFunc, (void *)strlen);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalstrcatFunc, (void *)strcat);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalmemsetFunc, (void *)memset);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalmallocFunc, (void *)malloc);
-        TheExecutionEngine->addGlobalMapping(SeExpr2LLVMEvalfreeFunc, (void *)free);
-
-        // [verify]
-        std::string errorStr;
-        llvm::raw_string_ostream raw(errorStr);
-        if (llvm::verifyModule(*altModule, &raw)) {
-            parseTree->addError(raw.str());
-            return false;
+        Builder.SetInsertPoint(loopBlock);
+        PHINode *index = Builder.CreatePHI(i32Ty, 2, "index");
+        index->addIncoming(args[2], entryBlock);
+        for (size_t m = 0; m < group.members.size(); m++)
+            Builder.CreateCall(memberFunctions[m], {results[m], data, index, args[4]});
+        for (size_t m = 0; m < group.members.size(); m++) {
+            unsigned dim = (unsigned)group.members[m].desiredReturnType.dim();
+            // indices never wrap, which lets the vectorizer see the accesses as strided
+            Value *output = Builder.CreateInBoundsGEP(
+                outputTy, outputBases[m], Builder.CreateMul(ConstantInt::get(i32Ty, dim), index, "", true, true));
+            for (unsigned i = 0; i < dim; i++) {
+                Value *result =
+                    Builder.CreateLoad(doubleTy, Builder.CreateConstInBoundsGEP1_32(doubleTy, results[m], i));
+                if (singlePrecision) result = Builder.CreateFPTrunc(result, outputTy);
+                Builder.CreateStore(result, Builder.CreateConstInBoundsGEP1_32(outputTy, output, i));
+            }
         }
+        Value *next = Builder.CreateAdd(index, ConstantInt::get(i32Ty, 1), "", true, true);
+        index->addIncoming(next, loopBlock);
+        Builder.CreateCondBr(Builder.CreateICmpULT(next, args[3]), loopBlock, loopEndBlock);
 
-        // Setup optimization
-        llvm::PassManagerBuilder builder;
-        std::unique_ptr<llvm::legacy::PassManager> pm(new llvm::legacy::PassManager);
-        std::unique_ptr<llvm::legacy::FunctionPassManager> fpm(new llvm::legacy::FunctionPassManager(altModule));
-        builder.OptLevel = 3;
-#if (LLVM_VERSION_MAJOR >= 4)
-        builder.Inliner = llvm::createAlwaysInlinerLegacyPass();
-#else
-        builder.Inliner = llvm::createAlwaysInlinerPass();
-#endif
-        builder.populateModulePassManager(*pm);
-        // fpm->add(new llvm::DataLayoutPass());
-        builder.populateFunctionPassManager(*fpm);
-        fpm->run(*F);
-        fpm->run(*FLOOP);
-        pm->run(*altModule);
+        Builder.SetInsertPoint(loopEndBlock);
+        Builder.CreateRetVoid();
 
-        // Create the JIT.  This takes ownership of the module.
+        functions.insert(functions.end(), memberFunctions.begin(), memberFunctions.end());
+        functions.push_back(FGROUP);
+    }
 
-        if (!TheExecutionEngine) {
+    //! Creates the JIT, taking ownership of the module, and maps the helper and standard functions the generated code
+    //! calls. The cache (if any) supplies or receives the module's machine code.
+    void createExecutionEngine(LLVMCompiledModule &compiled, std::unique_ptr<llvm::Module> module) {
+        using namespace llvm;
+        Module *altModule = module.get();
+        std::string ErrStr;
+        EngineBuilder builder(std::move(module));
+        builder.setErrorStr(&ErrStr).setTargetOptions(targetOptions());
+        //     .setUseMCJIT(true)
+        if (_profile == Expression::FinalProfile) {
+            // generate code for the host's instruction set (and vector width) rather than the generic target
+            builder.setOptLevel(CodeGenOpt::Aggressive).setMCPU(sys::getHostCPUName()).setMAttrs(targetFeatures());
+        } else
+            builder.setOptLevel(CodeGenOpt::Less);
+        compiled.engine.reset(builder.create());
+        if (!compiled.engine) {
             fprintf(stderr, "Could not create ExecutionEngine: %s\n", ErrStr.c_str());
             exit(1);
         }
 
-        TheExecutionEngine->finalizeObject();
-        void *fp = TheExecutionEngine->getPointerToFunction(F);
-        void *fpLoop = TheExecutionEngine->getPointerToFunction(FLOOP);
-        if (desireFP) {
-            _llvmEvalFP.reset(new LLVMEvaluationContext<double>);
-            _llvmEvalFP->init(fp, fpLoop, dimDesired);
-        } else {
-            _llvmEvalStr.reset(new LLVMEvaluationContext<char *>);
-            _llvmEvalStr->init(fp, fpLoop, dimDesired);
-        }
+        altModule->setDataLayout(compiled.engine->getDataLayout());
+        if (compiled.cache) compiled.engine->setObjectCache(compiled.cache.get());
 
-        if (Expression::debugging) {
-            #ifdef DEBUG
-            std::cerr << "Pre verified LLVM byte code " << std::endl;
-            altModule->print(llvm::errs(), nullptr);
-            #endif
+        // Add bindings to C linkage helper functions
+        std::map<std::string, void *> symbols = _standardFunctions;
+        symbols["SeExpr2LLVMEvalFPVarRef"] = (void *)SeExpr2LLVMEvalFPVarRef;
+        symbols["SeExpr2LLVMEvalStrVarRef"] = (void *)SeExpr2LLVMEvalStrVarRef;
+        symbols["SeExpr2LLVMEvalCustomFunction"] = (void *)SeExpr2LLVMEvalCustomFunction;
+        symbols["SeExpr2LLVMEvalStrConcat"] = (void *)SeExpr2LLVMEvalStrConcat;
+        symbols["SeExpr2LLVMEvalStrEqual"] = (void *)SeExpr2LLVMEvalStrEqual;
+        // (the noise builtins linkNoiseKernels linked in are internal to their modules and don't use their mapping)
+        for (auto &symbol : symbols) {
+            std::string mangled;
+            raw_string_ostream stream(mangled);
+            Mangler::getNameWithPrefix(stream, symbol.first, compiled.engine->getDataLayout());
+            compiled.engine->addGlobalMapping(stream.str(), (uint64_t)symbol.second);
         }
-
-        return true;
     }
 
-    std::string getUniqueName() const {
-        std::ostringstream o;
-        o << std::setbase(16) << (uint64_t)(this);
-        return ("_" + o.str());
+    //! Links the definitions of the noise builtins the module calls from the kernel bitcode, so the optimizer inlines
+    //! them (unrolling octave loops for constant octaves and vectorizing them with the point loop) instead of calling
+    //! them. Builtins replaced by other functions of the same name stay calls.
+    void linkNoiseKernels(LLVMSharedContext &context, llvm::Module *module) {
+        using namespace llvm;
+        // inlining them makes the module much larger, which isn't worth it for interactive use
+        if (_profile != Expression::FinalProfile) return;
+        const Module *kernels = context.noiseKernels();
+        if (!kernels) return;
+        static const std::map<std::string, void *> builtins = {
+            {standardFunctionSymbol("noise"), (void *)static_cast<double (*)(int, const Vec3d *)>(noise)},
+            {standardFunctionSymbol("snoise"), (void *)static_cast<double (*)(const Vec3d &)>(snoise)},
+            {standardFunctionSymbol("vnoise"), (void *)static_cast<Vec3d (*)(const Vec3d &)>(vnoise)},
+            {standardFunctionSymbol("turbulence"), (void *)static_cast<double (*)(int, const Vec3d *)>(turbulence)},
+            {standardFunctionSymbol("fbm"), (void *)static_cast<double (*)(int, const Vec3d *)>(fbm)},
+            {standardFunctionSymbol("cellnoise"), (void *)static_cast<double (*)(const Vec3d &)>(cellnoise)}};
+        std::set<std::string> used;
+        for (auto &builtin : builtins) {
+            auto called = _standardFunctions.find(builtin.first);
+            if (called != _standardFunctions.end() && called->second == builtin.second) used.insert(builtin.first);
+        }
+        if (used.empty()) return;
+
+        // only the entry points used are linked (with what they call), all internal to the module
+        std::unique_ptr<Module> copy = CloneModule(*kernels);
+        if (GlobalVariable *constructors = copy->getGlobalVariable("llvm.global_ctors")) constructors->eraseFromParent();
+        for (auto &builtin : builtins)
+            if (Function *function = copy->getFunction(builtin.first))
+                if (!used.count(builtin.first)) function->deleteBody();
+        std::vector<std::string> names;
+        for (Function &function : *copy)
+            if (!function.isDeclaration()) names.push_back(function.getName().str());
+        copy->setDataLayout(module->getDataLayout());
+        copy->setTargetTriple(module->getTargetTriple());
+        if (Linker::linkModules(*module, std::move(copy), Linker::LinkOnlyNeeded)) return;
+        for (const std::string &name : names) {
+            Function *function = module->getFunction(name);
+            if (!function || function->isDeclaration()) continue;
+            function->setLinkage(GlobalValue::InternalLinkage);
+            // the kernels are compiled for a generic target, the expression code for the host
+            function->removeFnAttr("target-cpu");
+            function->removeFnAttr("target-features");
+            function->removeFnAttr(Attribute::NoInline);
+            function->addFnAttr(Attribute::AlwaysInline);
+        }
     }
 };
 
+inline bool LLVMEvaluator::prepLLVM(ExprNode *parseTree,
+                                    ExprType desiredReturnType,
+                                    bool singlePrecision,
+                                    Expression::CompileProfile profile) {
+    LLVMBatch batch(profile);
+    batch.add(this, parseTree, desiredReturnType, singlePrecision);
+    return batch.compile();
+}
+
 #else  // no LLVM support
-class LLVMEvaluator {
+inline bool LLVMEvaluator::prepLLVM(ExprNode *parseTree,
+                                    ExprType desiredReturnType,
+                                    bool singlePrecision,
+                                    Expression::CompileProfile profile) {
+    throw std::runtime_error("LLVM is not enabled in build");
+}
+class LLVMBatch {
   public:
-    void unsupported() { throw std::runtime_error("LLVM is not enabled in build"); }
-    const char *evalStr(VarBlock *varBlock) {
-        unsupported();
-        return "";
+    explicit LLVMBatch(Expression::CompileProfile profile = Expression::FinalProfile, bool precompiling = false) {}
+    bool precompiling() const { return false; }
+    void add(LLVMEvaluator *evaluator, ExprNode *parseTree, ExprType desiredReturnType, bool singlePrecision) {
+        throw std::runtime_error("LLVM is not enabled in build");
     }
-    const double *evalFP(VarBlock *varBlock) {
-        unsupported();
-        return 0;
+    void addGroup(LLVMEvaluator *evaluator,
+                  const std::vector<std::pair<ExprNode *, ExprType>> &expressions,
+                  bool singlePrecision) {
+        throw std::runtime_error("LLVM is not enabled in build");
     }
-    bool prepLLVM(ExprNode *parseTree, ExprType desiredReturnType) {
-        unsupported();
+    bool compile() { return true; }
+    bool writeObject(const std::string &path, const std::string &cpu, std::string &error) {
+        error += "LLVM is not enabled in build\n";
         return false;
     }
-    void evalMultiple(VarBlock *varBlock, int outputVarBlockOffset, size_t rangeStart, size_t rangeEnd) {
-        unsupported();
-    }
-    void debugPrint() {}
 };
 #endif
 
@@ -31,6 +31,7 @@
 #include "Platform.h"
 #include "Noise.h"
 #include "Interpreter.h"
+#include "CPUDispatch.h"
 
 namespace SeExpr2 {
 
@@ -456,39 +457,7 @@ static const char* hash_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "Like rand, but with no internal seeds. Any number of seeds may be given\n"
     "and the result will be a random function based on all the seeds.");
 
-double noise(int n, const Vec3d* args) {
-    if (n < 1) return 0;
-    if (n == 1) {
-        // 1 arg = vector arg
-        double result;
-        double p[3] = {args[0][0], args[0][1], args[0][2]};
-        Noise<3, 1>(p, &result);
-        return .5 * result + .5;
-    }
-    // scalar args
-    if (n > 4) n = 4;
-    double p[4];
-    for (int i = 0; i < n; i++) p[i] = args[i][0];
-    double result;
-    switch (n) {
-        case 1:
-            Noise<1, 1>(p, &result);
-            break;
-        case 2:
-            Noise<2, 1>(p, &result);
-            break;
-        case 3:
-            Noise<3, 1>(p, &result);
-            break;
-        case 4:
-            Noise<4, 1>(p, &result);
-            break;
-        default:
-            result = 0;
-            break;
-    }
-    return .5 * result + .5;
-}
+// noise, snoise, vnoise, turbulence, fbm and cellnoise are defined in Noise.cpp
 static const char* noise_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "float noise ( vector v )\n"
     "float noise ( float x, float y )\n"
@@ -496,22 +465,10 @@ static const char* noise_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "float noise ( float x, float y, float z, float w )\n"
     "Original perlin noise at location (C2 interpolant)");
 
-double snoise(const Vec3d& p) {
-    double result;
-    double args[3] = {p[0], p[1], p[2]};
-    Noise<3, 1>(args, &result);
-    return result;
-}
 static const char* snoise_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "float snoise ( vector v)\n"
     "signed noise w/ range -1 to 1 formed with original perlin noise at location (C2 interpolant)");
 
-Vec3d vnoise(const Vec3d& p) {
-    Vec3d result;
-    double args[3] = {p[0], p[1], p[2]};
-    Noise<3, 3>(args, &result[0]);
-    return result;
-}
 static const char* vnoise_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "vector vnoise ( vector v)\n"
     "vector noise formed with original perlin noise at location (C2 interpolant)");
@@ -546,33 +503,6 @@ static const char* cnoise4_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "color cnoise4 ( vector v,float t)\n"
     "4D color noise formed with original perlin noise at location (C2 interpolant)");
 
-double turbulence(int n, const Vec3d* args) {
-    // args: octaves, lacunarity, gain
-    int octaves = 6;
-    double lacunarity = 2;
-    double gain = 0.5;
-    Vec3d p = 0.0;
-
-    switch (n) {
-        case 4:
-            gain = args[3][0];
-            /* fall through */
-        case 3:
-            lacunarity = args[2][0];
-            /* fall through */
-        case 2:
-            octaves = int(clamp(args[1][0], 1, 8));
-            /* fall through */
-        case 1:
-            p = args[0];
-    }
-
-    double result = 0;
-    double P[3] = {p[0], p[1], p[2]};
-    FBM<3, 1, true>(P, &result, octaves, lacunarity, gain);
-    return .5 * result + .5;
-}
-
 Vec3d vturbulence(int n, const Vec3d* args) {
     // args: octaves, lacunarity, gain
     int octaves = 6;
@@ -602,32 +532,6 @@ Vec3d vturbulence(int n, const Vec3d* args) {
 
 Vec3d cturbulence(int n, const Vec3d* args) { return vturbulence(n, args) * .5 + Vec3d(.5); }
 
-double fbm(int n, const Vec3d* args) {
-    // args: octaves, lacunarity, gain
-    int octaves = 6;
-    double lacunarity = 2;
-    double gain = 0.5;
-    Vec3d p = 0.0;
-
-    switch (n) {
-        case 4:
-            gain = args[3][0];
-            /* fall through */
-        case 3:
-            lacunarity = args[2][0];
-            /* fall through */
-        case 2:
-            octaves = int(clamp(args[1][0], 1, 8));
-            /* fall through */
-        case 1:
-            p = args[0];
-    }
-
-    double result = 0.0;
-    double P[3] = {p[0], p[1], p[2]};
-    FBM<3, 1, false>(P, &result, octaves, lacunarity, gain);
-    return .5 * result + .5;
-}
 static const char* fbm_docstring =  QT_TRANSLATE_NOOP_UTF8("builtin",
     "float fbm(vector v,int octaves=6,float lacunarity=2,float gain=.5)\n"
     "fbm (Fractal Brownian Motion) is a multi-frequency noise function. \n"
@@ -742,12 +646,6 @@ static const char* cfbm_docstring = QT_TRANSLATE_NOOP_UTF8("builtin", "color cfb
 Vec3d cfbm4(int n, const Vec3d* args) { return vfbm4(n, args) * .5 + Vec3d(.5); }
 static const char* cfbm4_docstring = QT_TRANSLATE_NOOP_UTF8("builtin", "color cfbm4(vector v,float time,int octaves=6,float lacunarity=2,float gain=.5)");
 
-double cellnoise(const Vec3d& p) {
-    double result;
-    double args[3] = {p[0], p[1], p[2]};
-    CellNoise<3, 1>(args, &result);
-    return result;
-}
 static const char* cellnoise_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "float cellnoise(vector v)\n"
     "cellnoise generates a field of constant colored cubes based on the integer location.\n"
@@ -800,7 +698,7 @@ static Vec3d* voronoi_points(VoronoiPointData& data, const Vec3d& cell, double j
     return data.points;
 }
 
-static void voronoi_f1_3d(VoronoiPointData& data, const Vec3d& p, double jitter, double& f1, Vec3d& pos1) {
+static void voronoi_f1_3d_kernel(VoronoiPointData& data, const Vec3d& p, double jitter, double& f1, Vec3d& pos1) {
     // from Advanced Renderman, page 257
     Vec3d thiscell(floor(p[0]) + 0.5, floor(p[1]) + 0.5, floor(p[2]) + 0.5);
 
@@ -819,13 +717,13 @@ static void voronoi_f1_3d(VoronoiPointData& data, const Vec3d& p, double jitter,
     f1 = sqrt(f1);
 }
 
-static void voronoi_f1f2_3d(VoronoiPointData& data,
-                            const Vec3d& p,
-                            double jitter,
-                            double& f1,
-                            Vec3d& pos1,
-                            double& f2,
-                            Vec3d& pos2) {
+static void voronoi_f1f2_3d_kernel(VoronoiPointData& data,
+                                   const Vec3d& p,
+                                   double jitter,
+                                   double& f1,
+                                   Vec3d& pos1,
+                                   double& f2,
+                                   Vec3d& pos2) {
     // from Advanced Renderman, page 258
     Vec3d thiscell(floor(p[0]) + 0.5, floor(p[1]) + 0.5, floor(p[2]) + 0.5);
     f1 = f2 = 1000;
@@ -849,6 +747,34 @@ static void voronoi_f1f2_3d(VoronoiPointData& data,
     f2 = sqrt(f2);
 }
 
+//! The searches above, compiled for the selected instruction set level
+struct VoronoiF1Kernel {
+    static void run(VoronoiPointData& data, const Vec3d& p, double jitter, double& f1, Vec3d& pos1) {
+        voronoi_f1_3d_kernel(data, p, jitter, f1, pos1);
+    }
+};
+
+struct VoronoiF1F2Kernel {
+    static void run(VoronoiPointData& data, const Vec3d& p, double jitter, double& f1, Vec3d& pos1, double& f2,
+                    Vec3d& pos2) {
+        voronoi_f1f2_3d_kernel(data, p, jitter, f1, pos1, f2, pos2);
+    }
+};
+
+static void voronoi_f1_3d(VoronoiPointData& data, const Vec3d& p, double jitter, double& f1, Vec3d& pos1) {
+    dispatch<VoronoiF1Kernel>(data, p, jitter, f1, pos1);
+}
+
+static void voronoi_f1f2_3d(VoronoiPointData& data,
+                            const Vec3d& p,
+                            double jitter,
+                            double& f1,
+                            Vec3d& pos1,
+                            double& f2,
+                            Vec3d& pos2) {
+    dispatch<VoronoiF1F2Kernel>(data, p, jitter, f1, pos1, f2, pos2);
+}
+
 Vec3d voronoiFn(VoronoiPointData& data, int n, const Vec3d* args) {
     // args = p, type, jitter,
     //        fbmScale, fbmOctaves, fbmLacunarity, fbmGain
@@ -1062,25 +988,43 @@ class CachedVoronoiFunc : public ExprFuncSimple {
     }
 
     virtual ExprFuncNode::Data* evalConstant(const ExprFuncNode* node, ArgHandle args) const {
-        return new VoronoiPointData();
+        return new Data(_vfunc);
     }
 
     virtual void eval(ArgHandle args) {
-        VoronoiPointData* data = static_cast<VoronoiPointData*>(args.data);
+        // the cell points are cached per thread, not in the node's data, so threads evaluating the same expression
+        // don't overwrite each other's
+        static thread_local VoronoiPointData data;
         int nargs = args.nargs();
         Vec3d* sevArgs = (Vec3d*)alloca(sizeof(Vec3d) * nargs);
 
         for (int i = 0; i < nargs; i++)
             for (int j = 0; j < 3; j++) sevArgs[i][j] = args.inFp<3>(i)[j];
 
-        Vec3d result = _vfunc(*data, nargs, sevArgs);
+        Vec3d result = _vfunc(data, nargs, sevArgs);
         double* out = &args.outFp;
         for (int i = 0; i < 3; i++) out[i] = result[i];
     }
 
+    static void evalNative(double* result, int numArgs, const double* fpArgs, char**, ExprFuncNode::Data* data) {
+        static thread_local VoronoiPointData pointData;
+        // the point takes three values, the constant arguments after it one each
+        Vec3d* sevArgs = (Vec3d*)alloca(sizeof(Vec3d) * numArgs);
+        sevArgs[0] = Vec3d(fpArgs[0], fpArgs[1], fpArgs[2]);
+        for (int i = 1; i < numArgs; i++) sevArgs[i] = Vec3d(fpArgs[2 + i]);
+
+        Vec3d value = static_cast<Data*>(data)->vfunc(pointData, numArgs, sevArgs);
+        for (int k = 0; k < 3; k++) result[k] = value[k];
+    }
+    virtual NativeFunc nativeFunction() const { return evalNative; }
+
     virtual ~CachedVoronoiFunc() {}
 
   private:
+    struct Data : public ExprFuncNode::Data {
+        Data(VoronoiFunc* vfunc) : vfunc(vfunc) {}
+        VoronoiFunc* vfunc;
+    };
     VoronoiFunc* _vfunc;
 } voronoi(voronoiFn), cvoronoi(cvoronoiFn), pvoronoi(pvoronoiFn);
 
@@ -1372,6 +1316,11 @@ class CurveFuncX : public ExprFuncSimple {
         args.outFp = data->curve.getValue(param);
     }
 
+    static void evalNative(double* result, int, const double* fpArgs, char**, ExprFuncNode::Data* data) {
+        result[0] = static_cast<CurveData<double>*>(data)->curve.getValue(fpArgs[0]);
+    }
+    virtual NativeFunc nativeFunction() const { return evalNative; }
+
 } curve;
 static const char* curve_docstring = QT_TRANSLATE_NOOP_UTF8("builtin",
     "float curve(float param,float pos0,float val0,int interp0,float pos1,float val1,int interp1,[...])\n\n"
@@ -1424,6 +1373,12 @@ class CCurveFuncX : public ExprFuncSimple {
         for (int k = 0; k < 3; k++) out[k] = result[k];
     }
 
+    static void evalNative(double* result, int, const double* fpArgs, char**, ExprFuncNode::Data* data) {
+        Vec3d value = static_cast<CurveData<Vec3d>*>(data)->curve.getValue(fpArgs[0]);
+        for (int k = 0; k < 3; k++) result[k] = value[k];
+    }
+    virtual NativeFunc nativeFunction() const { return evalNative; }
+
   public:
     CCurveFuncX() : ExprFuncSimple(true) {}  // Thread Safe
     virtual ~CCurveFuncX() {}
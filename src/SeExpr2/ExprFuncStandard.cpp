@@ -142,6 +142,172 @@ int FuncNVVOp(int* opData, double* fp, char** c, std::vector<int>& callStack) {
     return 1;
 }
 
+namespace {
+//! Batch kernels of the ops above, calling the function (the same in every lane) for each active lane. They save
+//! evalMultiple copying the operands of every lane in and out of a scalar frame around each call. The functions only
+//! have double versions, so float lanes are widened into the call and its result narrowed back.
+template <class T>
+inline double laneArg(const T* fp, int slot, int l) {
+    return fp[slot * Interpreter::batchSize + l];
+}
+
+template <class T>
+inline Vec3d laneVec(const T* fp, int slot, int l) {
+    const int W = Interpreter::batchSize;
+    return Vec3d(fp[slot * W + l], fp[(slot + 1) * W + l], fp[(slot + 2) * W + l]);
+}
+
+template <class T>
+inline void setLaneVec(T* fp, int slot, int l, const Vec3d& v) {
+    for (int k = 0; k < 3; k++) fp[(slot + k) * Interpreter::batchSize + l] = static_cast<T>(v[k]);
+}
+
+struct Func0Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func0*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[1] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) { out[l] = static_cast<T>(func()); });
+    }
+};
+struct Func1Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func1*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[2] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) { out[l] = static_cast<T>(func(laneArg(fp, opData[1], l))); });
+    }
+};
+struct Func2Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func2*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[3] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            out[l] = static_cast<T>(func(laneArg(fp, opData[1], l), laneArg(fp, opData[2], l)));
+        });
+    }
+};
+struct Func3Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func3*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[4] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            out[l] = static_cast<T>(
+                func(laneArg(fp, opData[1], l), laneArg(fp, opData[2], l), laneArg(fp, opData[3], l)));
+        });
+    }
+};
+struct Func4Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func4*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[5] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            out[l] = static_cast<T>(func(laneArg(fp, opData[1], l), laneArg(fp, opData[2], l),
+                                         laneArg(fp, opData[3], l), laneArg(fp, opData[4], l)));
+        });
+    }
+};
+struct Func5Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func5*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[6] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            out[l] = static_cast<T>(func(laneArg(fp, opData[1], l), laneArg(fp, opData[2], l),
+                                         laneArg(fp, opData[3], l), laneArg(fp, opData[4], l),
+                                         laneArg(fp, opData[5], l)));
+        });
+    }
+};
+struct Func6Batch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func6*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[7] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            out[l] = static_cast<T>(func(laneArg(fp, opData[1], l), laneArg(fp, opData[2], l),
+                                         laneArg(fp, opData[3], l), laneArg(fp, opData[4], l),
+                                         laneArg(fp, opData[5], l), laneArg(fp, opData[6], l)));
+        });
+    }
+};
+struct FuncNBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Funcn*)(c[opData[0] * Interpreter::batchSize]);
+        int n = opData[1];
+        double* vals = static_cast<double*>(alloca(n * sizeof(double)));
+        T* out = fp + opData[n + 2] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            for (int k = 0; k < n; k++) vals[k] = laneArg(fp, opData[k + 2], l);
+            out[l] = static_cast<T>(func(n, vals));
+        });
+    }
+};
+struct Func1VBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func1v*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[2] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) { out[l] = static_cast<T>(func(laneVec(fp, opData[1], l))); });
+    }
+};
+struct Func2VBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func2v*)(c[opData[0] * Interpreter::batchSize]);
+        T* out = fp + opData[3] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            out[l] = static_cast<T>(func(laneVec(fp, opData[1], l), laneVec(fp, opData[2], l)));
+        });
+    }
+};
+struct Func1VVBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func1vv*)(c[opData[0] * Interpreter::batchSize]);
+        forEachLane(lanes, numLanes, [&](int l) { setLaneVec(fp, opData[2], l, func(laneVec(fp, opData[1], l))); });
+    }
+};
+struct Func2VVBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Func2vv*)(c[opData[0] * Interpreter::batchSize]);
+        forEachLane(lanes, numLanes, [&](int l) {
+            setLaneVec(fp, opData[3], l, func(laneVec(fp, opData[1], l), laneVec(fp, opData[2], l)));
+        });
+    }
+};
+struct FuncNVBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Funcnv*)(c[opData[0] * Interpreter::batchSize]);
+        int n = opData[1];
+        Vec3d* vals = static_cast<Vec3d*>(alloca(n * sizeof(Vec3d)));
+        T* out = fp + opData[n + 2] * Interpreter::batchSize;
+        forEachLane(lanes, numLanes, [&](int l) {
+            for (int k = 0; k < n; k++) new (vals + k) Vec3d(laneVec(fp, opData[k + 2], l));
+            out[l] = static_cast<T>(func(n, vals));
+        });
+    }
+};
+struct FuncNVVBatch {
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        auto func = (ExprFuncStandard::Funcnvv*)(c[opData[0] * Interpreter::batchSize]);
+        int n = opData[1];
+        Vec3d* vals = static_cast<Vec3d*>(alloca(n * sizeof(Vec3d)));
+        forEachLane(lanes, numLanes, [&](int l) {
+            for (int k = 0; k < n; k++) new (vals + k) Vec3d(laneVec(fp, opData[k + 2], l));
+            setLaneVec(fp, opData[n + 2], l, func(n, vals));
+        });
+    }
+};
+}
+
 int ExprFuncStandard::buildInterpreter(const ExprFuncNode* node, Interpreter* interpreter) const {
     std::vector<int> argOps;
     for (int c = 0; c < node->numChildren(); c++) {
@@ -154,48 +320,63 @@ int ExprFuncStandard::buildInterpreter(const ExprFuncNode* node, Interpreter* in
     interpreter->s[funcPtrLoc] = (char*)_func;
 
     Interpreter::OpF op = 0;
+    Interpreter::BatchOp batchOp;
     switch (_funcType) {
         case FUNC0:
             op = Func0Op;
+            batchOp = getBatchOp<Func0Batch>();
             break;
         case FUNC1:
             op = Func1Op;
+            batchOp = getBatchOp<Func1Batch>();
             break;
         case FUNC2:
             op = Func2Op;
+            batchOp = getBatchOp<Func2Batch>();
             break;
         case FUNC3:
             op = Func3Op;
+            batchOp = getBatchOp<Func3Batch>();
             break;
         case FUNC4:
             op = Func4Op;
+            batchOp = getBatchOp<Func4Batch>();
             break;
         case FUNC5:
             op = Func5Op;
+            batchOp = getBatchOp<Func5Batch>();
             break;
         case FUNC6:
             op = Func6Op;
+            batchOp = getBatchOp<Func6Batch>();
             break;
         case FUNCN:
             op = FuncNOp;
+            batchOp = getBatchOp<FuncNBatch>();
             break;
         case FUNC1V:
             op = Func1VOp;
+            batchOp = getBatchOp<Func1VBatch>();
             break;
         case FUNC2V:
             op = Func2VOp;
+            batchOp = getBatchOp<Func2VBatch>();
             break;
         case FUNCNV:
             op = FuncNVOp;
+            batchOp = getBatchOp<FuncNVBatch>();
             break;
         case FUNC1VV:
             op = Func1VVOp;
+            batchOp = getBatchOp<Func1VVBatch>();
             break;
         case FUNC2VV:
             op = Func2VVOp;
+            batchOp = getBatchOp<Func2VVBatch>();
             break;
         case FUNCNVV:
             op = FuncNVVOp;
+            batchOp = getBatchOp<FuncNVVBatch>();
             break;
         default:
             assert(false);
@@ -204,16 +385,17 @@ int ExprFuncStandard::buildInterpreter(const ExprFuncNode* node, Interpreter* in
     if (_funcType < VEC) {
         retOp = interpreter->allocFP(node->type().dim());
         for (int k = 0; k < node->type().dim(); k++) {
-            interpreter->addOp(op);
-            interpreter->addOperand(funcPtrLoc);
-            if (_funcType == FUNCN) interpreter->addOperand(static_cast<int>(argOps.size()));
+            interpreter->addOp(op, batchOp);
+            interpreter->addOperand(funcPtrLoc, Interpreter::okPTRIN);
+            if (_funcType == FUNCN)
+                interpreter->addOperand(static_cast<int>(argOps.size()), Interpreter::okIMMEDIATE);
             for (size_t c = 0; c < argOps.size(); c++) {
                 if (node->child(c)->type().isFP(1))
-                    interpreter->addOperand(argOps[c]);
+                    interpreter->addOperand(argOps[c], Interpreter::okFPIN);
                 else
-                    interpreter->addOperand(argOps[c] + k);
+                    interpreter->addOperand(argOps[c] + k, Interpreter::okFPIN);
             }
-            interpreter->addOperand(retOp + k);
+            interpreter->addOperand(retOp + k, Interpreter::okFPOUT);
             interpreter->endOp();
         }
     } else {
@@ -221,21 +403,22 @@ int ExprFuncStandard::buildInterpreter(const ExprFuncNode* node, Interpreter* in
         for (size_t c = 0; c < argOps.size(); c++)
             if (node->child(c)->type().dim() == 1) {
                 int promotedArgOp = interpreter->allocFP(3);
-                interpreter->addOp(Promote<3>::f);
-                interpreter->addOperand(argOps[c]);
-                interpreter->addOperand(promotedArgOp);
+                interpreter->addOp(Promote<3>::f, getBatchOp<Promote<3> >());
+                interpreter->addOperand(argOps[c], Interpreter::okFPIN);
+                interpreter->addOperand(promotedArgOp, Interpreter::okFPOUT, 3);
                 interpreter->endOp();
                 argOps[c] = promotedArgOp;
             }
         retOp = interpreter->allocFP(_funcType >= VECVEC ? 3 : 1);
 
-        interpreter->addOp(op);
-        interpreter->addOperand(funcPtrLoc);
-        if (_funcType == FUNCNV || _funcType == FUNCNVV) interpreter->addOperand(static_cast<int>(argOps.size()));
+        interpreter->addOp(op, batchOp);
+        interpreter->addOperand(funcPtrLoc, Interpreter::okPTRIN);
+        if (_funcType == FUNCNV || _funcType == FUNCNVV)
+            interpreter->addOperand(static_cast<int>(argOps.size()), Interpreter::okIMMEDIATE);
         for (size_t c = 0; c < argOps.size(); c++) {
-            interpreter->addOperand(argOps[c]);
+            interpreter->addOperand(argOps[c], Interpreter::okFPIN, 3);
         }
-        interpreter->addOperand(retOp);
+        interpreter->addOperand(retOp, Interpreter::okFPOUT, _funcType >= VECVEC ? 3 : 1);
         interpreter->endOp();
     }
     if (Expression::debugging) {
@@ -38,10 +38,11 @@ int ExprFuncSimple::buildInterpreter(const ExprFuncNode *node, Interpreter *inte
         std::cerr<<"we are "<<node->promote(c)<<" "<<c<<std::endl;
 #endif
         if (node->promote(c) != 0) {
-            interpreter->addOp(getTemplatizedOp<Promote>(node->promote(c)));
+            interpreter->addOp(getTemplatizedOp<Promote>(node->promote(c)),
+                               getTemplatizedBatchOp<Promote>(node->promote(c)));
             int promotedOperand = interpreter->allocFP(node->promote(c));
-            interpreter->addOperand(operand);
-            interpreter->addOperand(promotedOperand);
+            interpreter->addOperand(operand, Interpreter::okFPIN);
+            interpreter->addOperand(promotedOperand, Interpreter::okFPOUT, node->promote(c));
             operand = promotedOperand;
             interpreter->endOp();
         }
@@ -61,12 +62,22 @@ int ExprFuncSimple::buildInterpreter(const ExprFuncNode *node, Interpreter *inte
     int ptrLoc = interpreter->allocPtr();
     int ptrDataLoc = interpreter->allocPtr();
     interpreter->s[ptrLoc] = (char *)this;
-    interpreter->addOperand(ptrLoc);
-    interpreter->addOperand(ptrDataLoc);
-    interpreter->addOperand(outoperand);
-    interpreter->addOperand(nargsData);
+    interpreter->addOperand(ptrLoc, Interpreter::okPTRIN);
+    interpreter->addOperand(ptrDataLoc, Interpreter::okPTRIN);
+    if (node->type().isFP())
+        interpreter->addOperand(outoperand, Interpreter::okFPOUT, node->type().dim());
+    else
+        interpreter->addOperand(outoperand, Interpreter::okPTROUT);
+    interpreter->addOperand(nargsData, Interpreter::okFPIN);
     for (size_t c = 0; c < operands.size(); c++) {
-        interpreter->addOperand(operands[c]);
+        const ExprType &argType = node->child(c)->type();
+        if (argType.isFP())
+            interpreter->addOperand(
+                operands[c], Interpreter::okFPIN, node->promote(c) ? node->promote(c) : argType.dim());
+        else if (argType.isString())
+            interpreter->addOperand(operands[c], Interpreter::okPTRIN);
+        else
+            interpreter->addOperand(operands[c]);
     }
     interpreter->endOp(false);  // do not eval because the function may not be evaluatable!
 
@@ -112,7 +112,18 @@ class ExprFuncSimple : public ExprFuncX {
     virtual ExprFuncNode::Data* evalConstant(const ExprFuncNode* node, ArgHandle args) const = 0;
     virtual void eval(ArgHandle args) = 0;
 
+    //! C entry point equivalent to eval that LLVM code calls directly (after a first call through eval set up data).
+    //! result gets the FP value of the node's type, numArgs is the number of arguments of the call, fpArgs holds the
+    //! FP arguments one after another (each promoted to ExprFuncNode::promote components when that is set), strArgs
+    //! the string arguments and data is what evalConstant returned.
+    typedef void (*NativeFunc)(double* result, int numArgs, const double* fpArgs, char** strArgs,
+                               ExprFuncNode::Data* data);
+    //! Entry point of the function if it has one (by default LLVM code calls eval through a generic trampoline).
+    //! Only FP returning calls use it, string returning ones always go through eval.
+    virtual NativeFunc nativeFunction() const { return nullptr; }
+
   private:
+    friend class Interpreter;  // recognizes EvalOp when optimizing programs
     static int EvalOp(int* opData, double* fp, char** c, std::vector<int>& callStack);
 };
 
@@ -15,6 +15,51 @@
  http://www.apache.org/licenses/LICENSE-2.0
 */
 #include "ExprConfig.h"
+#include "ExprFunc.h"
+#include "StringArena.h"
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#ifndef SEEXPR_WIN32
+#include <dlfcn.h>
+#endif
+
+// String helper of generated code, which precompiled expressions use in builds without LLVM too. The arena is the
+// one the evaluator passed the code (see LLVMEvaluator).
+extern "C" char *SeExpr2LLVMEvalStrConcat(SeExpr2::StringArena *strings, const char *a, const char *b) {
+    return strings->concat(a, b);
+}
+
+//! 1 when a and b hold the same characters (interned literals are equal by address)
+extern "C" int SeExpr2LLVMEvalStrEqual(const char *a, const char *b) { return a == b || strcmp(a, b) == 0; }
+
+namespace SeExpr2 {
+std::string standardFunctionSymbol(const std::string &name) { return "SeExpr2Std_" + name; }
+
+std::string nativeFunctionSymbol(const std::string &name, const ExprFuncX *func) {
+    // the class tells apart function objects registered under the same name (e.g. by different function tables), and
+    // unlike their address stays the same across runs
+    const char *type = typeid(*func).name();
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char *c = type; *c; c++) hash = (hash ^ (unsigned char)*c) * 1099511628211ULL;
+    std::ostringstream o;
+    o << "SeExpr2Native_" << name << "_" << std::setbase(16) << hash;
+    return o.str();
+}
+
+std::string functionOrigin(const void *address) {
+#ifndef SEEXPR_WIN32
+    Dl_info info, library;
+    if (dladdr(address, &info) && info.dli_fname &&
+        dladdr(reinterpret_cast<const void *>(&functionOrigin), &library) && info.dli_fbase != library.dli_fbase)
+        return info.dli_fname;
+#endif
+    return "";
+}
+}
 
 #ifdef SEEXPR_ENABLE_LLVM
 #include "ExprLLVM.h"
@@ -24,6 +69,7 @@
 #include "VarBlock.h"
 #include "StringUtils.h"
 #include <array>
+#include <cmath>
 using namespace llvm;
 using namespace SeExpr2;
 
@@ -36,6 +82,9 @@ Function *llvm_getFunction(LLVM_BUILDER Builder) { return Builder.GetInsertBlock
 
 Module *llvm_getModule(LLVM_BUILDER Builder) { return llvm_getFunction(Builder)->getParent(); }
 
+//! Position of the StringArena among the parameters of the expression's function and its local functions
+const int stringArenaArg = 3;
+
 //! Turn LLVM type into a std::string, convenience to work around needing to use raw_string_ostream everywhere
 std::string llvmTypeString(llvm::Type *type) {
     std::string myString;
@@ -393,6 +442,22 @@ LLVM_VALUE callPrintf(const ExprFuncNode *seFunc, LLVM_BUILDER Builder, Function
 }
 
 // TODO: not good. need better implementation.
+//! Kind of the metadata telling which call a custom function slot is for
+const char *customFunctionSlotKind = "seexpr2.node";
+
+//! The global the code calling funcNode loads its node from: the slot declared for it (see declareCustomFunctionSlot),
+//! or for code generated without one the node's address
+GlobalVariable *customFunctionSlot(Module *module, const ExprFuncNode *funcNode) {
+    Type *int64Ty = Type::getInt64Ty(module->getContext());
+    for (GlobalVariable &global : module->globals())
+        if (MDNode *node = global.getMetadata(customFunctionSlotKind))
+            if (mdconst::extract<ConstantInt>(node->getOperand(0))->getZExtValue() ==
+                reinterpret_cast<uint64_t>(funcNode))
+                return &global;
+    return new GlobalVariable(*module, int64Ty, true, GlobalValue::InternalLinkage,
+                              ConstantInt::get(int64Ty, reinterpret_cast<uint64_t>(funcNode)));
+}
+
 LLVM_VALUE callCustomFunction(const ExprFuncNode *funcNode, LLVM_BUILDER Builder) {
     LLVMContext &llvmContext = Builder.getContext();
 
@@ -490,7 +555,24 @@ LLVM_VALUE callCustomFunction(const ExprFuncNode *funcNode, LLVM_BUILDER Builder
     // TODO: This leaks!
     GlobalVariable *dataGV = new GlobalVariable(*module, int8PtrTy, false, GlobalValue::InternalLinkage, ConstantPointerNull::get(int8PtrTy));
 
-    // call the function
+    // the first call goes through the trampoline (which gets the data from evalConstant), later calls go straight to
+    // the function's native entry point when it has one
+    const ExprFuncSimple *funcSimple = dynamic_cast<const ExprFuncSimple *>(funcNode->func()->funcx());
+    BasicBlock *nativeBlock = nullptr, *doneBlock = nullptr;
+    LLVM_VALUE data = nullptr;
+    if (funcSimple && funcSimple->nativeFunction() && funcNode->type().isFP()) {
+        Function *F = llvm_getFunction(Builder);
+        BasicBlock *trampolineBlock = BasicBlock::Create(llvmContext, "trampoline", F);
+        nativeBlock = BasicBlock::Create(llvmContext, "native", F);
+        doneBlock = BasicBlock::Create(llvmContext, "called", F);
+        data = Builder.CreateLoad(int8PtrTy, dataGV);
+        Builder.CreateCondBr(Builder.CreateIsNull(data), trampolineBlock, nativeBlock);
+        Builder.SetInsertPoint(trampolineBlock);
+    }
+
+    // call the function (the node doesn't change while the code runs, so its load is hoisted out of the point loop)
+    LoadInst *node = Builder.CreateLoad(int64Ty, customFunctionSlot(module, funcNode));
+    node->setMetadata(LLVMContext::MD_invariant_load, MDNode::get(llvmContext, llvm::None));
     Builder.CreateCall(
         module->getFunction("SeExpr2LLVMEvalCustomFunction"),
         {
@@ -498,10 +580,31 @@ LLVM_VALUE callCustomFunction(const ExprFuncNode *funcNode, LLVM_BUILDER Builder
             fpArg,
             strArg,
             dataGV,
-            ConstantInt::get(int64Ty, (uint64_t)funcNode)
+            node
         }
     );
 
+    if (nativeBlock) {
+        Builder.CreateBr(doneBlock);
+        Builder.SetInsertPoint(nativeBlock);
+        // the trampoline's argument layout already matches: result at fp[1], arguments after it, strings from c[2]
+        Type *fpPtrTy = PointerType::getUnqual(doubleTy);
+        Type *strPtrTy = PointerType::getUnqual(int8PtrTy);
+        FunctionType *nativeTy = FunctionType::get(Type::getVoidTy(llvmContext),
+                                                   {fpPtrTy, int32Ty, fpPtrTy, strPtrTy, int8PtrTy}, false);
+        std::string symbol = nativeFunctionSymbol(funcNode->name(), funcSimple);
+        Function *native = module->getFunction(symbol);
+        if (!native) native = Function::Create(nativeTy, GlobalValue::ExternalLinkage, symbol, module);
+        Builder.CreateCall(native,
+                           {Builder.CreateConstGEP1_32(doubleTy, fpArg, 1),
+                            ConstantInt::get(int32Ty, nargs),
+                            Builder.CreateConstGEP1_32(doubleTy, fpArg, 1 + sizeOfRet),
+                            Builder.CreateConstGEP1_32(int8PtrTy, strArg, 2),
+                            data});
+        Builder.CreateBr(doneBlock);
+        Builder.SetInsertPoint(doneBlock);
+    }
+
     // read the result from memory
     int resultOffset = 1;
     if (funcNode->type().isFP()) {
@@ -529,6 +632,15 @@ extern "C" void SeExpr2LLVMEvalStrVarRef(ExprVarRef *seVR, char **result) { seVR
 
 namespace SeExpr2 {
 
+void declareCustomFunctionSlot(Module *module, const ExprFuncNode *funcNode, const std::string &name) {
+    Type *int64Ty = Type::getInt64Ty(module->getContext());
+    GlobalVariable *slot = new GlobalVariable(*module, int64Ty, false, GlobalValue::ExternalLinkage,
+                                              ConstantInt::get(int64Ty, 0), name);
+    // only codegen reads which call the slot is for, the machine code doesn't depend on it
+    Constant *node = ConstantInt::get(int64Ty, reinterpret_cast<uint64_t>(funcNode));
+    slot->setMetadata(customFunctionSlotKind, MDNode::get(module->getContext(), ConstantAsMetadata::get(node)));
+}
+
 LLVM_VALUE promoteToDim(LLVM_VALUE val, unsigned dim, LLVM_BUILDER Builder) {
     Type *srcTy = val->getType();
     if (srcTy->isVectorTy() || dim <= 1) return val;
@@ -600,42 +712,10 @@ LLVM_VALUE ExprBinaryOpNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
             }
         }
     } else {
-        // precompute a few things
-        LLVMContext &context    = Builder.getContext();
-        Module      *module     = llvm_getModule(Builder);
-        PointerType *i8PtrPtrTy = PointerType::getUnqual(Type::getInt8PtrTy(context));
-        Type        *i32Ty      = Type::getInt32Ty(context);
-        Function    *strlen     = module->getFunction("strlen");
-        Function    *malloc     = module->getFunction("malloc");
-        Function    *free       = module->getFunction("free");
-        Function    *memset     = module->getFunction("memset");
-        Function    *strcat     = module->getFunction("strcat");
-
-        // do magic (see the pseudo C code on the comments at the end
-        // of each LLVM instruction)
-
-        // compute the length of the operand strings
-        LLVM_VALUE len1 = Builder.CreateCall(strlen, { op1 });              // len1 = strlen(op1);
-        LLVM_VALUE len2 = Builder.CreateCall(strlen, { op2 });              // len2 = strlen(op2);
-        LLVM_VALUE len = Builder.CreateAdd(len1, len2);                     // len = len1 + len2;
-
-        // allocate and clear memory
-        LLVM_VALUE alloc = Builder.CreateCall(malloc, { len });             // alloc = malloc(len1 + len2);
-        LLVM_VALUE zero = ConstantInt::get(i32Ty, 0);                       // zero = 0;
-        Builder.CreateCall(memset, { alloc, zero, len });                   // memset(alloc, zero, len);
-
-        // concatenate operand strings into output string
-        Builder.CreateCall(strcat, { alloc, op1 });                         // strcat(alloc, op1);
-        LLVM_VALUE newAlloc = Builder.CreateGEP(nullptr, alloc, len1);      // newAlloc = alloc + len1
-        Builder.CreateCall(strcat, { newAlloc, op2 });                      // strcat(alloc, op2);
-
-        // store the address in the node's _out member so that it will be
-        // cleaned up when the expression is destroyed.
-        APInt outAddr = APInt(64, (uint64_t)&_out);
-        LLVM_VALUE out = Constant::getIntegerValue(i8PtrPtrTy, outAddr);    // out = &_out;
-        Builder.CreateCall(free, { Builder.CreateLoad(out) });              // free(*out);
-        Builder.CreateStore(alloc, out);                                    // *out = alloc
-        return alloc;
+        // the result lives in the string arena the evaluator passed the function (and its local functions)
+        Function *concat = llvm_getModule(Builder)->getFunction("SeExpr2LLVMEvalStrConcat");
+        LLVM_VALUE strings = &*std::next(llvm_getFunction(Builder)->arg_begin(), stringArenaArg);
+        return Builder.CreateCall(concat, {strings, op1, op2});
     }
 
     assert(false && "unexpected op");
@@ -662,6 +742,14 @@ LLVM_VALUE ExprLocalVar::codegen(LLVM_BUILDER Builder, const std::string &varNam
 }
 
 LLVM_VALUE ExprCompareEqNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
+    if (child(0)->type().isString()) {
+        Function *equal = llvm_getModule(Builder)->getFunction("SeExpr2LLVMEvalStrEqual");
+        LLVM_VALUE isEqual = Builder.CreateCall(equal, {child(0)->codegen(Builder), child(1)->codegen(Builder)});
+        LLVM_VALUE boolVal = _op == '=' ? Builder.CreateICmpNE(isEqual, ConstantInt::get(isEqual->getType(), 0))
+                                        : Builder.CreateICmpEQ(isEqual, ConstantInt::get(isEqual->getType(), 0));
+        return Builder.CreateUIToFP(boolVal, Type::getDoubleTy(Builder.getContext()));
+    }
+
     LLVM_VALUE op1 = getFirstElement(child(0)->codegen(Builder), Builder);
     LLVM_VALUE op2 = getFirstElement(child(1)->codegen(Builder), Builder);
 
@@ -820,6 +908,7 @@ LLVM_VALUE ExprFuncNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
     std::string calleeName(name());
 
     /************* call local function or printf *************/
+    if (_localFunc) return _localFunc->codegenForCall(this, Builder);
     Function *callee = M->getFunction(calleeName);
     if (calleeName == "printf") {
         if (!callee) {
@@ -827,7 +916,7 @@ LLVM_VALUE ExprFuncNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
             callee = Function::Create(FT, GlobalValue::ExternalLinkage, "printf", llvm_getModule(Builder));
         }
         return callPrintf(this, Builder, callee);
-    } else if (callee) {
+    } else if (callee && !callee->hasLocalLinkage()) {  // not a local function of another expression in the module
         std::vector<LLVM_VALUE> args =
             promoteArgs(codegenFuncCallArgs(Builder, this), Builder, callee->getFunctionType());
         return Builder.CreateCall(callee, args);
@@ -842,9 +931,10 @@ LLVM_VALUE ExprFuncNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
     // get function pointer
     ExprFuncStandard::FuncType seFuncType = standfunc->getFuncType();
     FunctionType *llvmFuncType = getSeExprFuncStandardLLVMType(seFuncType, llvmContext);
-    void *fp = standfunc->getFuncPointer();
-    ConstantInt *funcAddr = ConstantInt::get(Type::getInt64Ty(llvmContext), (uint64_t)fp);
-    LLVM_VALUE addrVal = Builder.CreateIntToPtr(funcAddr, PointerType::getUnqual(llvmFuncType));
+    // called through a symbol the evaluator maps to the function, so the machine code can be cached across runs
+    std::string symbol = standardFunctionSymbol(calleeName);
+    LLVM_VALUE addrVal = M->getFunction(symbol);
+    if (!addrVal) addrVal = Function::Create(llvmFuncType, GlobalValue::ExternalLinkage, symbol, M);
 
     // Collect distribution positions
     std::vector<LLVM_VALUE> args = codegenFuncCallArgs(Builder, this);
@@ -963,36 +1053,57 @@ LLVM_VALUE ExprIfThenElseNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
     return 0;
 }
 
+// Local functions take the evaluated function's parameters first, so their bodies can read variables the same way
+static const int numLocalFunctionHiddenArgs = 4;
+
 LLVM_VALUE ExprLocalFunctionNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
     IRBuilder<>::InsertPoint oldIP = Builder.saveIP();
     LLVMContext &llvmContext = Builder.getContext();
 
     // codegen prototype
     Function *F = cast<Function>(child(0)->codegen(Builder));
+    _llvmFunction = F;
+    // small and single use functions are expanded into their callers, the others are called
+    F->addFnAttr(inlineCalls() ? Attribute::AlwaysInline : Attribute::NoInline);
 
     // create alloca for args
     BasicBlock *BB = BasicBlock::Create(llvmContext, "entry", F);
     Builder.SetInsertPoint(BB);
     Function::arg_iterator AI = F->arg_begin();
-    for (int i = 0, e = F->arg_size(); i != e; ++i, ++AI) {
-        AllocaInst *Alloca = createAllocaInst(Builder, AI->getType(), 1, AI->getName());
-        Alloca->takeName(&*AI);
-        Builder.CreateStore(&*AI, Alloca);
+    std::advance(AI, numLocalFunctionHiddenArgs);
+    for (int i = 0; i < prototype()->numChildren(); ++i, ++AI) {
+        const ExprVarNode *childNode = static_cast<const ExprVarNode *>(prototype()->arg(i));
+        LLVM_VALUE varPtr = childNode->localVar()->codegen(Builder, childNode->name(), &*AI);
+        Builder.CreateStore(&*AI, varPtr);
     }
 
-    LLVM_VALUE result = 0;
-    for (int i = 1; i < numChildren(); i++) result = child(i)->codegen(Builder);
-
+    LLVM_VALUE result = promoteToTy(child(1)->codegen(Builder), F->getReturnType(), Builder);
     Builder.CreateRet(result);
     Builder.restoreIP(oldIP);
     return 0;
 }
 
+LLVM_VALUE ExprLocalFunctionNode::codegenForCall(const ExprFuncNode *callerNode, LLVM_BUILDER Builder) LLVM_BODY {
+    Function *F = cast<Function>(_llvmFunction);
+    Function *caller = llvm_getFunction(Builder);
+
+    std::vector<LLVM_VALUE> args;
+    Function::arg_iterator AI = caller->arg_begin();
+    for (int i = 0; i < numLocalFunctionHiddenArgs; ++i, ++AI) args.push_back(&*AI);
+    std::vector<LLVM_VALUE> callArgs = codegenFuncCallArgs(Builder, callerNode);
+    for (unsigned i = 0; i < callArgs.size(); ++i)
+        args.push_back(
+            promoteToTy(callArgs[i], F->getFunctionType()->getParamType(numLocalFunctionHiddenArgs + i), Builder));
+    return Builder.CreateCall(F, args);
+}
+
 LLVM_VALUE ExprPrototypeNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
     LLVMContext &llvmContext = Builder.getContext();
 
-    // get arg type
+    // get arg type, the parameters of the function being generated come first
     std::vector<Type *> ParamTys;
+    FunctionType *parentTy = llvm_getFunction(Builder)->getFunctionType();
+    for (int i = 0; i < numLocalFunctionHiddenArgs; ++i) ParamTys.push_back(parentTy->getParamType(i));
     for (int i = 0; i < numChildren(); ++i) ParamTys.push_back(createLLVMTyForSeExprType(llvmContext, argType(i)));
     // get ret type
     Type *retTy = createLLVMTyForSeExprType(llvmContext, returnType());
@@ -1002,6 +1113,8 @@ LLVM_VALUE ExprPrototypeNode::codegen(LLVM_BUILDER Builder) LLVM_BODY {
 
     // Set names for all arguments.
     auto AI = F->arg_begin();
+    const char *hiddenNames[] = {"outputPointer", "dataBlock", "indirectIndex", "stringArena"};
+    for (int i = 0; i < numLocalFunctionHiddenArgs; ++i, ++AI) AI->setName(hiddenNames[i]);
     for (int i = 0, e = numChildren(); i != e; ++i, ++AI) {
         const ExprVarNode *childNode = dynamic_cast<const ExprVarNode *>(child(i));
         assert(childNode);
@@ -1089,6 +1202,43 @@ struct VarCodeGeneration {
         return ret;
     }
 
+    //! Loads the element of a channel of the given (non native) type at pointer, as a double
+    static LLVM_VALUE loadChannelElement(LLVM_BUILDER Builder, LLVM_VALUE pointer, ChannelType type) {
+        LLVMContext &llvmContext = Builder.getContext();
+        Type *doubleTy = Type::getDoubleTy(llvmContext), *floatTy = Type::getFloatTy(llvmContext);
+        Type *i32Ty = Type::getInt32Ty(llvmContext);
+        switch (type) {
+            case ChannelType::Float32:
+                return Builder.CreateFPExt(
+                    Builder.CreateLoad(floatTy, Builder.CreatePointerCast(pointer, PointerType::getUnqual(floatTy))),
+                    doubleTy);
+            case ChannelType::UInt8: {
+                Value *value = Builder.CreateLoad(Type::getInt8Ty(llvmContext), pointer);
+                return Builder.CreateFMul(Builder.CreateUIToFP(value, doubleTy), ConstantFP::get(doubleTy, 1. / 255));
+            }
+            case ChannelType::Half: {
+                // the magnitude bits shifted into a float are off by the exponent bias difference (2^112), which
+                // multiplying restores, subnormals included. Infinity and nan only need the exponent filled.
+                Type *i16Ty = Type::getInt16Ty(llvmContext);
+                Value *half = Builder.CreateZExt(
+                    Builder.CreateLoad(i16Ty, Builder.CreatePointerCast(pointer, PointerType::getUnqual(i16Ty))),
+                    i32Ty);
+                Value *magnitude = Builder.CreateShl(Builder.CreateAnd(half, 0x7fff), 13);
+                Value *scaled = Builder.CreateFMul(Builder.CreateBitCast(magnitude, floatTy),
+                                                   ConstantFP::get(floatTy, std::ldexp(1., 112)));
+                Value *special =
+                    Builder.CreateICmpEQ(Builder.CreateAnd(half, 0x7c00), ConstantInt::get(i32Ty, 0x7c00));
+                Value *bits = Builder.CreateSelect(
+                    special, Builder.CreateOr(magnitude, 0x7f800000), Builder.CreateBitCast(scaled, i32Ty));
+                bits = Builder.CreateOr(bits, Builder.CreateShl(Builder.CreateAnd(half, 0x8000), 16));
+                return Builder.CreateFPExt(Builder.CreateBitCast(bits, floatTy), doubleTy);
+            }
+            default:
+                return Builder.CreateLoad(doubleTy,
+                                          Builder.CreatePointerCast(pointer, PointerType::getUnqual(doubleTy)));
+        }
+    }
+
     static LLVM_VALUE codegen(VarBlockCreator::Ref *varRef, const std::string &varName, LLVM_BUILDER Builder) {
         LLVMContext &llvmContext = Builder.getContext();
 
@@ -1102,17 +1252,51 @@ struct VarCodeGeneration {
 
         int dim = varRef->type().dim();
 
+        // the data block is double** or float** (single precision), float data is widened on load
         Type *ptrToPtrTy = variableBlock->getType();
+        Type *elementPtrTy = ptrToPtrTy->getPointerElementType();
+        Type *elementTy = elementPtrTy->getPointerElementType();
+        Type *doubleTy = Type::getDoubleTy(llvmContext);
         Value *variableBlockAsPtrPtr = Builder.CreatePointerCast(variableBlock, ptrToPtrTy);
         Value *variableOffsetIndex = ConstantInt::get(Type::getInt32Ty(llvmContext), variableOffset);
-        Value *variableBlockIndirectPtrPtr = Builder.CreateInBoundsGEP(variableBlockAsPtrPtr, variableOffsetIndex);
-        Value *baseMemory = Builder.CreateLoad(variableBlockIndirectPtrPtr);
+        Value *variableBlockIndirectPtrPtr =
+            Builder.CreateInBoundsGEP(elementPtrTy, variableBlockAsPtrPtr, variableOffsetIndex);
+        Value *baseMemory = Builder.CreateLoad(elementPtrTy, variableBlockIndirectPtrPtr);
+        if (varRef->type().isString()) {
+            // the data is a const char* per point
+            Type *i8PtrTy = Type::getInt8PtrTy(llvmContext);
+            Value *strings = Builder.CreatePointerCast(baseMemory, PointerType::getUnqual(i8PtrTy));
+            Value *index = varRef->type().isLifetimeUniform()
+                               ? static_cast<Value *>(ConstantInt::get(indirectIndex->getType(), 0))
+                               : static_cast<Value *>(indirectIndex);
+            return Builder.CreateLoad(i8PtrTy, Builder.CreateInBoundsGEP(i8PtrTy, strings, index), varName);
+        }
+        if (varRef->format().type != ChannelType::Native) {
+            // the elements are at byte offsets from the data pointer and converted to double on load
+            const ChannelFormat &format = varRef->format();
+            Type *i64Ty = Type::getInt64Ty(llvmContext), *i8Ty = Type::getInt8Ty(llvmContext);
+            Value *bytes = Builder.CreatePointerCast(baseMemory, Type::getInt8PtrTy(llvmContext));
+            Value *pointOffset =
+                varRef->type().isLifetimeUniform()
+                    ? ConstantInt::get(i64Ty, 0)
+                    : Builder.CreateMul(Builder.CreateZExt(indirectIndex, i64Ty),
+                                        ConstantInt::get(i64Ty, format.byteStride), "", true, true);
+            std::vector<Value *> loadedValues(dim);
+            for (int component = 0; component < dim; component++) {
+                Value *elementOffset = Builder.CreateAdd(
+                    pointOffset, ConstantInt::get(i64Ty, component * channelTypeSize(format.type)), "", true, true);
+                loadedValues[component] =
+                    loadChannelElement(Builder, Builder.CreateInBoundsGEP(i8Ty, bytes, elementOffset), format.type);
+            }
+            return dim == 1 ? loadedValues[0] : createVecVal(Builder, loadedValues, varName);
+        }
         Value *variableStrideValue = ConstantInt::get(Type::getInt32Ty(llvmContext), variableStride);
         if (dim == 1) {
             /// If we are uniform always assume indirectIndex is 0 (there's only one value)
-            Value *variablePointer =
-                varRef->type().isLifetimeUniform() ? baseMemory : Builder.CreateInBoundsGEP(baseMemory, indirectIndex);
-            return Builder.CreateLoad(variablePointer);
+            Value *variablePointer = varRef->type().isLifetimeUniform()
+                                         ? baseMemory
+                                         : Builder.CreateInBoundsGEP(elementTy, baseMemory, indirectIndex);
+            return Builder.CreateFPExt(Builder.CreateLoad(elementTy, variablePointer), doubleTy);
         } else {
             std::vector<Value *> loadedValues(dim);
             for (int component = 0; component < dim; component++) {
@@ -1120,12 +1304,13 @@ struct VarCodeGeneration {
                 /// If we are uniform always assume indirectIndex is 0 (there's only one value)
                 Value *variablePointer =
                     varRef->type().isLifetimeUniform()
-                        ? Builder.CreateInBoundsGEP(Type::getDoubleTy(llvmContext), baseMemory, componentIndex)
+                        ? Builder.CreateInBoundsGEP(elementTy, baseMemory, componentIndex)
                         : Builder.CreateInBoundsGEP(
-                              Type::getDoubleTy(llvmContext),
+                              elementTy,
                               baseMemory,
-                              Builder.CreateAdd(Builder.CreateMul(indirectIndex, variableStrideValue), componentIndex));
-                loadedValues[component] = Builder.CreateLoad(variablePointer, varName);
+                              Builder.CreateAdd(Builder.CreateMul(indirectIndex, variableStrideValue, "", true, true),
+                                                componentIndex, "", true, true));
+                loadedValues[component] = Builder.CreateFPExt(Builder.CreateLoad(elementTy, variablePointer, varName), doubleTy);
             }
             return createVecVal(Builder, loadedValues, varName);
         }
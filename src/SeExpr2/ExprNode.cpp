@@ -17,6 +17,7 @@
 
 #ifndef MAKEDEPEND
 #include <math.h>
+#include <cstdlib>
 #include <sstream>
 #include <algorithm>
 #endif
@@ -139,22 +140,26 @@ ExprType ExprModuleNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuilder) {
 ExprType ExprPrototypeNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuilder) {
     bool error = false;
 
-#if 0 // TODO: implement prototype
-    if (_retTypeSet) checkCondition(returnType().isValid(), "Function has bad return type", error);
-
-    _argTypes.clear();
-    for (int c = 0; c < numChildren(); c++) {
-        ExprType type = child(c)->type();
-        checkCondition(type.isValid(), "Function has a parameter with a bad type", error);
-        _argTypes.push_back(type);
-        ExprLocalVar* localVar = new ExprLocalVar(type);
-        envBuilder.current()->add(((ExprVarNode*)child(c))->name(), localVar);
-        std::cerr << "after create localvar phi " << localVar->getPhi() << std::endl;
-        child(c)->prep(wantScalar, envBuilder);
+    // only prototypes of local functions are supported, they declare the parameters in the function's scope
+    if (checkCondition(dynamic_cast<const ExprLocalFunctionNode*>(parent()),
+                       ErrorCode::Unknown,
+                       { "Prototypes are currently not supported" },
+                       error)) {
+        if (_retTypeSet)
+            checkCondition(returnType().isValid(), ErrorCode::Unknown, { "Function has bad return type" }, error);
+
+        _argTypes.clear();
+        for (int c = 0; c < numChildren(); c++) {
+            ExprType type = child(c)->type();
+            checkCondition(type.isValid(), ErrorCode::Unknown, { "Function has a parameter with a bad type" }, error);
+            _argTypes.push_back(type);
+            // parameters are typed constant in the body, so its lifetime tells what calls depend on besides arguments
+            std::unique_ptr<ExprLocalVar> localVar(new ExprLocalVar(ExprType(type).Constant()));
+            envBuilder.current()->add(static_cast<ExprVarNode*>(child(c))->name(), std::move(localVar));
+            child(c)->prep(wantScalar, envBuilder);
+        }
     }
-#else
-    checkCondition(false, ErrorCode::Unknown, { "Prototypes are currently not supported" }, error);
-#endif
+
     if (error)
         setType(ExprType().Error());
     else
@@ -172,29 +177,28 @@ void ExprPrototypeNode::addArgTypes(ExprNode* surrogate) {
 
 void ExprPrototypeNode::addArgs(ExprNode* surrogate) {
     ExprNode::addChildren(surrogate);
-#if 0
-    ExprNode * child;
-    ExprType type;
-    for(int i = 0; i < numChildren(); i++) {
-        child = this->child(i);
-        type = child->type();
+}
 
-        _argTypes.push_back(type);
-        _env.add(((ExprVarNode*)child)->name(), new ExprLocalVar(type));
-    }
-#endif
+int ExprLocalFunctionNode::inlineLimit = getenv("SE_EXPR_INLINE_LIMIT") ? atoi(getenv("SE_EXPR_INLINE_LIMIT")) : 32;
+
+namespace {
+int countNodes(const ExprNode* node) {
+    int count = 1;
+    for (int c = 0; c < node->numChildren(); c++) count += countNodes(node->child(c));
+    return count;
+}
 }
 
 ExprType ExprLocalFunctionNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuilder) {
     bool error = false;
 
-#if 0  // TODO: no local functions for now
+    // the body gets its own scope that sees the functions defined before
+    ExprVarEnv* env = envBuilder.current();
+    envBuilder.setCurrent(envBuilder.createDescendant(env));
 
     // prep prototype and check for errors
-    ExprPrototypeNode* prototype = (ExprPrototypeNode*)child(0);
-    ExprVarEnv functionEnv;
-    functionEnv.resetAndSetParent(&env);
-    if (!prototype->prep(false, functionEnv).isValid()) error = true;
+    ExprPrototypeNode* prototype = static_cast<ExprPrototypeNode*>(child(0));
+    if (!prototype->prep(false, envBuilder).isValid()) error = true;
 
     // decide what return type we want
     bool returnWantsScalar = false;
@@ -202,29 +206,31 @@ ExprType ExprLocalFunctionNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuil
 
     // prep block and check for errors
     ExprNode* block = child(1);
-    ExprType blockType = block->prep(returnWantsScalar, functionEnv);
+    ExprType blockType = block->prep(returnWantsScalar, envBuilder);
+    envBuilder.setCurrent(env);
 
     if (!error && blockType.isValid()) {
         if (prototype->isReturnTypeSet()) {
-            if (blockType != prototype->returnType()) {
-                checkCondition(false,
-                               "In function result of block '" + blockType.toString() +
-                                   "' does not match given return type " + prototype->returnType().toString(),
-                               error);
-            }
-
+            ExprType returnType = prototype->returnType();
+            bool compatible = returnType.isString() ? blockType.isString()
+                                                    : blockType.isFP() && (blockType.dim() == 1 ||
+                                                                           blockType.dim() == returnType.dim());
+            if (checkCondition(compatible && returnType.isLifeCompatible(blockType),
+                               ErrorCode::Unknown,
+                               { "In function result of block '" + blockType.toString() +
+                                 "' does not match given return type " + returnType.toString() },
+                               error))
+                prototype->setReturnType(returnType.setLifetime(blockType));
         } else
             prototype->setReturnType(blockType);
-        // register the function in the symbol table
-
-        env.addFunction(prototype->name(), this);
     } else {
-        checkCondition(false, "Invalid type for blockType is " + blockType.toString(), error);
-        error = true;
+        checkCondition(false, ErrorCode::Unknown, { "Invalid type for blockType is " + blockType.toString() }, error);
     }
-#else
-    checkCondition(false, ErrorCode::Unknown, { "Local functions are currently not supported." }, error);
-#endif
+
+    // register the function in the symbol table
+    if (!error) env->addFunction(prototype->name(), this);
+    _numCalls = 0;
+    _bodySize = countNodes(block);
 
     if (error)
         setType(ExprType().Error());
@@ -234,25 +240,21 @@ ExprType ExprLocalFunctionNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuil
     return _type;
 }
 
-// TODO: write buildInterpreter for local function node
 ExprType ExprLocalFunctionNode::prep(ExprFuncNode* callerNode, bool scalarWanted, ExprVarEnvBuilder& envBuilder) const {
-#if 0
     bool error = false;
-    callerNode->checkCondition(callerNode->numChildren() == prototype()->numChildren(),
-                               "Incorrect number of arguments to function call",
-                               error);
-    for (int i = 0; i < callerNode->numChildren(); i++) {
-        // TODO: is this right?
-        // bool compatible=ExprType::valuesCompatible(callerNode->child(i)->prep(false,env), prototype()->argType(i));
-        if (!callerNode->checkArg(i, prototype()->argType(i), envBuilder)) error = true;
-        // callerNode->child(i)->checkCondition(compatible,"Incorrect type for argument",error);
+    int numArgs = callerNode->numChildren(), numParams = prototype()->numChildren();
+    if (callerNode->checkCondition(
+            numArgs >= numParams, ErrorCode::FunctionTooFewArguments, { prototype()->name() }, error) &&
+        callerNode->checkCondition(
+            numArgs <= numParams, ErrorCode::FunctionTooManyArguments, { prototype()->name() }, error)) {
+        for (int i = 0; i < numArgs; i++)
+            if (!callerNode->checkArg(i, prototype()->argType(i), envBuilder)) error = true;
+    } else {
+        // prep arguments anyways to catch as many errors as possible!
+        for (int i = 0; i < numArgs; i++) callerNode->child(i)->prep(false, envBuilder);
     }
+    _numCalls++;
     return error ? ExprType().Error() : prototype()->returnType();
-#else
-    bool error = false;
-    callerNode->checkCondition(false, ErrorCode::Unknown, {"Local functions are currently not supported." }, error);
-    return ExprType().Error();
-#endif
 }
 
 ExprType ExprBlockNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuilder) {
@@ -540,8 +542,10 @@ ExprType ExprFuncNode::prep(bool wantScalar, ExprVarEnvBuilder& envBuilder) {
     _func = 0;
     if (ExprLocalFunctionNode* localFunction = envBuilder.current()->findFunction(_name)) {
         _localFunc = localFunction;
-        setTypeWithChildLife(localFunction->prep(this, wantScalar, envBuilder));
-        // TODO: we need to type check arguments here
+        // a call lives as long as its arguments and whatever else the body depends on
+        ExprType type = localFunction->prep(this, wantScalar, envBuilder);
+        setTypeWithChildLife(type);
+        if (type.isValid()) _type.setLifetime(_type, type);
     } else {
         if (!_func) _func = _expr->resolveFunc(_name);
         if (!_func) _func = ExprFunc::lookup(_name);
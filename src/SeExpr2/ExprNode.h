@@ -243,6 +243,10 @@ class ExprModuleNode : public ExprNode {
 
     virtual ExprType prep(bool wantScalar, ExprVarEnvBuilder& envBuilder);
     virtual int buildInterpreter(Interpreter* interpreter) const;
+    /// Builds the local functions, which go before the program's start, and then the expression body. Programs
+    /// holding several expressions build all of their functions before any of their bodies.
+    void buildInterpreterForFunctions(Interpreter* interpreter) const;
+    int buildInterpreterForBody(Interpreter* interpreter) const;
     virtual LLVM_VALUE codegen(LLVM_BUILDER) LLVM_BODY;
 };
 
@@ -302,7 +306,8 @@ class ExprFuncNode;
 class ExprLocalFunctionNode : public ExprNode {
   public:
     ExprLocalFunctionNode(const Expression* expr, ExprPrototypeNode* prototype, ExprNode* block)
-        : ExprNode(expr, prototype, block) {}
+        : ExprNode(expr, prototype, block), _procedurePC(-1), _returnedDataOp(-1), _numCalls(0), _bodySize(0),
+          _llvmFunction(0) {}
 
     /// Preps the definition of this site
     virtual ExprType prep(bool wantScalar, ExprVarEnvBuilder& envBuilder);
@@ -316,10 +321,27 @@ class ExprLocalFunctionNode : public ExprNode {
     /// Build interpreter if we are called
     int buildInterpreterForCall(const ExprFuncNode* callerNode, Interpreter* interpreter) const;
     virtual LLVM_VALUE codegen(LLVM_BUILDER) LLVM_BODY;
+    /// Generate a call to this function
+    LLVM_VALUE codegenForCall(const ExprFuncNode* callerNode, LLVM_BUILDER) LLVM_BODY;
+
+    /// Whether calls are expanded in place rather than calling one shared body. True for functions called at most
+    /// once or with at most inlineLimit nodes in their body.
+    bool inlineCalls() const { return inlineLimit >= 0 && (_numCalls <= 1 || _bodySize <= inlineLimit); }
+    /// Body size up to which every call is expanded in place (defaults to 32 nodes, SE_EXPR_INLINE_LIMIT sets it, a
+    /// negative limit never expands calls)
+    static int inlineLimit;
 
   private:
+    /// Build the body, returns the slot holding its result promoted to the return type
+    int buildBody(Interpreter* interpreter) const;
+
     mutable int _procedurePC;
     mutable int _returnedDataOp;
+    /// Number of call sites and body nodes (set by prep)
+    mutable int _numCalls;
+    int _bodySize;
+    /// Function generated for out of line calls
+    mutable LLVM_VALUE _llvmFunction;
 };
 
 /// Node that computes local variables before evaluating expression
@@ -445,15 +467,13 @@ class ExprCompareNode : public ExprNode {
 /// Node that implements an binary operator
 class ExprBinaryOpNode : public ExprNode {
   public:
-    ExprBinaryOpNode(const Expression* expr, ExprNode* a, ExprNode* b, char op) : ExprNode(expr, a, b), _op(op), _out(0) {}
-    virtual ~ExprBinaryOpNode() { free(_out); }
+    ExprBinaryOpNode(const Expression* expr, ExprNode* a, ExprNode* b, char op) : ExprNode(expr, a, b), _op(op) {}
 
     virtual ExprType prep(bool wantScalar, ExprVarEnvBuilder& envBuilder);
     virtual int buildInterpreter(Interpreter* interpreter) const;
     virtual LLVM_VALUE codegen(LLVM_BUILDER) LLVM_BODY;
 
     char _op;
-    char* _out;
 };
 
 /// Node that references a variable
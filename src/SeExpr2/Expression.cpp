@@ -20,6 +20,7 @@
 #include <stack>
 #include <algorithm>
 #include <sstream>
+#include <atomic>
 #endif
 
 #include "ExprConfig.h"
@@ -30,12 +31,25 @@
 #include "ExprType.h"
 #include "ExprEnv.h"
 #include "Platform.h"
+#include "Mutex.h"
 
 #include "Evaluator.h"
 #include "ExprWalker.h"
+#include "ThreadPool.h"
+#include "VarBlock.h"
 
+#include <condition_variable>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
 #include <typeinfo>
+#ifndef SEEXPR_WIN32
+#include <dlfcn.h>
+#endif
+#if defined(WINDOWS) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace SeExpr2 {
 
@@ -56,8 +70,8 @@ static Expression::EvaluationStrategy chooseDefaultEvaluationStrategy() {
 #ifdef SEEXPR_ENABLE_LLVM
     if (char* env = getenv("SE_EXPR_EVAL")) {
         if (Expression::debugging) std::cerr << "Overriding SeExpr Evaluation Default to be " << env << std::endl;
-        return !strcmp(env, "LLVM") ? Expression::UseLLVM : !strcmp(env, "INTERPRETER") ? Expression::UseInterpreter
-                                                                                        : Expression::UseInterpreter;
+        return !strcmp(env, "LLVM") ? Expression::UseLLVM : !strcmp(env, "TIERED") ? Expression::UseTiered
+                                                                                   : Expression::UseInterpreter;
     } else
         return Expression::UseLLVM;
 #else
@@ -65,6 +79,198 @@ static Expression::EvaluationStrategy chooseDefaultEvaluationStrategy() {
 #endif
 }
 Expression::EvaluationStrategy Expression::defaultEvaluationStrategy = chooseDefaultEvaluationStrategy();
+size_t Expression::tieredThreshold =
+    getenv("SE_EXPR_TIERED_THRESHOLD") ? strtoul(getenv("SE_EXPR_TIERED_THRESHOLD"), nullptr, 10) : 100000;
+Expression::EvaluationPrecision Expression::defaultEvaluationPrecision =
+    getenv("SE_EXPR_PRECISION") && !strcmp(getenv("SE_EXPR_PRECISION"), "float") ? Expression::UseFloat
+                                                                                 : Expression::UseDouble;
+
+size_t Expression::parallelGrain = getenv("SE_EXPR_GRAIN") ? strtoul(getenv("SE_EXPR_GRAIN"), nullptr, 10) : 0;
+
+Expression::CompileProfile Expression::defaultCompileProfile =
+    getenv("SE_EXPR_COMPILE_PROFILE") && !strcmp(getenv("SE_EXPR_COMPILE_PROFILE"), "interactive")
+        ? Expression::InteractiveProfile
+        : Expression::FinalProfile;
+
+static SeExprInternal2::Mutex llvmCacheMutex;
+static std::string llvmCacheDir = getenv("SE_EXPR_CACHE_DIR") ? getenv("SE_EXPR_CACHE_DIR") : "";
+static std::atomic<size_t> llvmCacheHitCount(0), llvmCacheMissCount(0);
+
+void Expression::setLLVMCacheDirectory(const std::string& directory) {
+    SeExprInternal2::AutoMutex locker(llvmCacheMutex);
+    llvmCacheDir = directory;
+}
+
+std::string Expression::llvmCacheDirectory() {
+    SeExprInternal2::AutoMutex locker(llvmCacheMutex);
+    return llvmCacheDir;
+}
+
+size_t Expression::llvmCacheHits() { return llvmCacheHitCount; }
+
+size_t Expression::llvmCacheMisses() { return llvmCacheMissCount; }
+
+void Expression::countLLVMCacheLookup(bool hit) { ++(hit ? llvmCacheHitCount : llvmCacheMissCount); }
+
+std::string Expression::llvmTarget() {
+#ifdef SEEXPR_ENABLE_LLVM
+    return LLVMBatch::targetDescription();
+#else
+    return "";
+#endif
+}
+
+static SeExprInternal2::Mutex precompiledMutex;
+static std::vector<void*> precompiledLibraries;
+
+//! Whether a library's key is key followed by the target it was compiled for (see precompiledTarget), and the
+//! instruction set level that target needs is at most the selected one (see CPUDispatch.h)
+static bool precompiledKeyRuns(const char* libraryKey, const std::string& key) {
+    if (strncmp(libraryKey, key.c_str(), key.size()) || strncmp(libraryKey + key.size(), "target ", 7)) return false;
+    const char* isa = strstr(libraryKey + key.size(), "\nisa ");
+    if (!isa) return false;
+    for (int level = ISABaseline; level <= selectedISALevel(); level++)
+        if (!strcmp(isa + 5, (isaLevelName(ISALevel(level)) + std::string("\n")).c_str())) return true;
+    return false;
+}
+
+bool Expression::loadPrecompiled(const std::string& path) {
+#ifdef SEEXPR_WIN32
+    std::cerr << "SeExpr: warning precompiled expressions are not supported on windows currently" << std::endl;
+    return false;
+#else
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        std::cerr << "Error reading precompiled expressions: " << path << std::endl;
+        const char* err = dlerror();
+        if (err) std::cerr << err << std::endl;
+        return false;
+    }
+    SeExprInternal2::AutoMutex locker(precompiledMutex);
+    precompiledLibraries.push_back(handle);
+    return true;
+#endif
+}
+
+bool Expression::bindPrecompiled() const {
+#ifdef SEEXPR_WIN32
+    return false;
+#else
+    SeExprInternal2::AutoMutex locker(precompiledMutex);
+    if (precompiledLibraries.empty()) return false;
+    bool cacheable = true;
+    std::map<std::string, void*> symbols;
+    std::string key = codeKey(_parseTree, _desiredReturnType, _evaluationPrecision == UseFloat, cacheable, symbols);
+    // precompiled code is shared by every expression binding it, custom function calls need code of their own
+    std::vector<const ExprFuncNode*> customFunctionCalls;
+    collectCustomFunctionCalls(_parseTree, customFunctionCalls);
+    if (!cacheable || !customFunctionCalls.empty()) return false;
+    std::string name = precompiledSymbol(key);
+    symbols["SeExpr2LLVMEvalStrConcat"] = (void*)SeExpr2LLVMEvalStrConcat;
+    symbols["SeExpr2LLVMEvalStrEqual"] = (void*)SeExpr2LLVMEvalStrEqual;
+    for (void* library : precompiledLibraries) {
+        const char* libraryKey = (const char*)dlsym(library, (name + "_key").c_str());
+        void* fp = dlsym(library, (name + "_func").c_str());
+        void* fpLoop = dlsym(library, (name + "_loopfunc").c_str());
+        if (!libraryKey || !precompiledKeyRuns(libraryKey, key) || !fp || !fpLoop) continue;
+        // the code calls standard functions and helpers through slots (only the ones it uses exist)
+        for (auto& symbol : symbols)
+            if (void** slot = (void**)dlsym(library, precompiledImport(symbol.first).c_str())) *slot = symbol.second;
+        _llvmEvaluator->init(nullptr, fp, fpLoop, _desiredReturnType.isFP(), (unsigned)_desiredReturnType.dim());
+        _llvmEvaluator->addExpression(_parseTree, _desiredReturnType, _evaluationPrecision == UseFloat);
+        return true;
+    }
+    return false;
+#endif
+}
+
+#ifdef SEEXPR_ENABLE_LLVM
+namespace {
+//! Compiles the tiered expressions that got hot on one long lived thread. The ones queued while it is busy are
+//! compiled next, together: an LLVMBatch per compile profile, in the thread's shared LLVM context.
+class TieredCompiler {
+  public:
+    struct Job {
+        LLVMEvaluator* evaluator;
+        ExprNode* parseTree;
+        ExprType desiredReturnType;
+        bool singlePrecision;
+        Expression::CompileProfile profile;
+        //! Set once the evaluator's code can be run
+        std::atomic<bool>* ready;
+    };
+
+    //! Destroyed at exit. Every Expression constructor touches it first, so it outlives the static expressions that
+    //! may still cancel their compile when they are destroyed.
+    static TieredCompiler& instance() {
+        static TieredCompiler compiler;
+        return compiler;
+    }
+
+    //! Drops the queued compiles and waits for the running ones
+    ~TieredCompiler() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queue.clear();
+            _stopping = true;
+            _wake.notify_one();
+        }
+        if (_thread.joinable()) _thread.join();
+    }
+
+    //! Queues the compile of owner's code (the thread is started by the first one)
+    void enqueue(const void* owner, const Job& job) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stopping) return;
+        if (!_thread.joinable()) _thread = std::thread(&TieredCompiler::threadMain, this);
+        _queue.push_back({owner, job});
+        _wake.notify_one();
+    }
+
+    //! Drops owner's compile if it is still queued, or waits for it if it is running
+    void cancel(const void* owner) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _queue.erase(std::remove_if(_queue.begin(), _queue.end(),
+                                    [owner](const std::pair<const void*, Job>& job) { return job.first == owner; }),
+                     _queue.end());
+        _done.wait(lock, [&]() { return std::find(_compiling.begin(), _compiling.end(), owner) == _compiling.end(); });
+    }
+
+  private:
+    void threadMain() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _wake.wait(lock, [this]() { return !_queue.empty() || _stopping; });
+            if (_stopping) return;
+            std::vector<std::pair<const void*, Job>> jobs;
+            jobs.swap(_queue);
+            for (const auto& job : jobs) _compiling.push_back(job.first);
+            lock.unlock();
+
+            LLVMBatch batches[] = {LLVMBatch(Expression::FinalProfile), LLVMBatch(Expression::InteractiveProfile)};
+            for (const auto& job : jobs)
+                batches[job.second.profile].add(job.second.evaluator, job.second.parseTree,
+                                                job.second.desiredReturnType, job.second.singlePrecision);
+            for (LLVMBatch& batch : batches) batch.compile();
+            for (const auto& job : jobs)
+                if (job.second.evaluator->prepared()) job.second.ready->store(true, std::memory_order_release);
+
+            lock.lock();
+            _compiling.clear();
+            _done.notify_all();
+        }
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _wake, _done;
+    std::vector<std::pair<const void*, Job>> _queue;
+    //! Owners of the jobs being compiled
+    std::vector<const void*> _compiling;
+    std::thread _thread;
+    bool _stopping = false;
+};
+}
+#endif
 
 class TypePrintExaminer : public SeExpr2::Examiner<true> {
   public:
@@ -94,6 +300,9 @@ Expression::Expression(Expression::EvaluationStrategy evaluationStrategy)
       _desiredReturnType(ExprType().FP(3).Varying()), _parseTree(nullptr), _isValid(false), _parsed(false), _prepped(false),
       _interpreter(nullptr), _llvmEvaluator(new LLVMEvaluator()) {
     ExprFunc::init();
+#ifdef SEEXPR_ENABLE_LLVM
+    TieredCompiler::instance();
+#endif
 }
 
 Expression::Expression(const std::string& e,
@@ -104,9 +313,13 @@ Expression::Expression(const std::string& e,
       _desiredReturnType(type), _parseTree(nullptr), _isValid(false), _parsed(false), _prepped(false), _interpreter(nullptr),
       _llvmEvaluator(new LLVMEvaluator()) {
     ExprFunc::init();
+#ifdef SEEXPR_ENABLE_LLVM
+    TieredCompiler::instance();
+#endif
 }
 
 Expression::~Expression() {
+    // also drops the expression's background compile or waits for it
     reset();
     delete _llvmEvaluator;
 }
@@ -120,6 +333,11 @@ void Expression::debugPrintInterpreter() const {
 
 void Expression::debugPrintLLVM() const { _llvmEvaluator->debugPrint(); }
 
+std::string Expression::llvmIR() const {
+    prepIfNeeded();
+    return _llvmEvaluator->ir();
+}
+
 void Expression::debugPrintParseTree() const {
     if (_parseTree) {
         // print the parse tree
@@ -132,14 +350,19 @@ void Expression::debugPrintParseTree() const {
 }
 
 void Expression::reset() {
+#ifdef SEEXPR_ENABLE_LLVM
+    // a background compile still uses the parse tree and the evaluator
+    if (_tieredStarted) TieredCompiler::instance().cancel(this);
+#endif
+    _tieredPoints = 0;
+    _tieredStarted = false;
+    _llvmReady = false;
     delete _llvmEvaluator;
     _llvmEvaluator = new LLVMEvaluator();
     delete _parseTree;
     _parseTree = nullptr;
-    if (_evaluationStrategy == UseInterpreter) {
-        delete _interpreter;
-        _interpreter = nullptr;
-    }
+    delete _interpreter;
+    _interpreter = nullptr;
     _isValid = 0;
     _parsed = 0;
     _prepped = 0;
@@ -169,6 +392,22 @@ void Expression::setVarBlockCreator(const VarBlockCreator* creator) {
     _varBlockCreator = creator;
 }
 
+void Expression::setEvaluationPrecision(EvaluationPrecision precision) {
+    reset();
+    _evaluationPrecision = precision;
+}
+
+void Expression::setCompileProfile(CompileProfile profile) {
+    reset();
+    _compileProfile = profile;
+}
+
+Expression::CompileTimings Expression::compileTimings() const {
+    prepIfNeeded();
+    // a tiered expression's timings are written by its background compile until its code is used
+    return _isValid && useLLVM() ? _llvmEvaluator->timings() : CompileTimings();
+}
+
 void Expression::setExpr(const std::string& e) {
     if (_expression != "") reset();
     _expression = e;
@@ -228,33 +467,36 @@ void Expression::prep() const {
     } else {
         _isValid = true;
 
-        if (_evaluationStrategy == UseInterpreter) {
+        if (_evaluationStrategy != UseLLVM) {
             if (debugging) {
                 debugPrintParseTree();
                 std::cerr << "Eval strategy is interpreter" << std::endl;
             }
             assert(!_interpreter);
-            _interpreter = new Interpreter;
-            _returnSlot = _parseTree->buildInterpreter(_interpreter);
-            if (_desiredReturnType.isFP()) {
-                int dimWanted = _desiredReturnType.dim();
-                int dimHave = _parseTree->type().dim();
-                if (dimWanted > dimHave) {
-                    _interpreter->addOp(getTemplatizedOp<Promote>(dimWanted));
-                    int finalOp = _interpreter->allocFP(dimWanted);
-                    _interpreter->addOperand(_returnSlot);
-                    _interpreter->addOperand(finalOp);
-                    _returnSlot = finalOp;
-                    _interpreter->endOp();
-                }
-            }
+            _interpreter = new Interpreter(_evaluationPrecision == UseFloat);
+            _returnSlot = buildInterpreterResult(_interpreter, _parseTree->buildInterpreter(_interpreter));
+            _returnSlot = _interpreter->finalize(
+                _returnSlot,
+                _parseTree->type().isString() ? Interpreter::okPTRIN : Interpreter::okFPIN,
+                _desiredReturnType.isFP() ? _desiredReturnType.dim() : 1,
+                _parseTree->type().isLifetimeConstant());
             if (debugging) _interpreter->print();
+            // precompiled code needs no compile to wait for
+            if (_evaluationStrategy == UseTiered && bindPrecompiled()) {
+                _tieredStarted = true;
+                _llvmReady = true;
+            }
         } else {  // useLLVM
             if (debugging) {
                 std::cerr << "Eval strategy is llvm" << std::endl;
                 debugPrintParseTree();
             }
-            if (!_llvmEvaluator->prepLLVM(_parseTree, _desiredReturnType)) {
+            if ((!_llvmBatch || !_llvmBatch->precompiling()) && bindPrecompiled()) {
+                if (debugging) std::cerr << "Using precompiled code" << std::endl;
+            } else if (_llvmBatch)
+                _llvmBatch->add(_llvmEvaluator, _parseTree, _desiredReturnType, _evaluationPrecision == UseFloat);
+            else if (!_llvmEvaluator->prepLLVM(_parseTree, _desiredReturnType, _evaluationPrecision == UseFloat,
+                                               _compileProfile)) {
                 error = true;
             }
         }
@@ -294,6 +536,60 @@ void Expression::prep() const {
     }
 }
 
+int Expression::buildInterpreterResult(Interpreter* interpreter, int returnSlot) const {
+    if (_desiredReturnType.isFP()) {
+        int dimWanted = _desiredReturnType.dim();
+        int dimHave = _parseTree->type().dim();
+        if (dimWanted > dimHave) {
+            interpreter->addOp(getTemplatizedOp<Promote>(dimWanted), getTemplatizedBatchOp<Promote>(dimWanted));
+            int finalOp = interpreter->allocFP(dimWanted);
+            interpreter->addOperand(returnSlot, Interpreter::okFPIN);
+            interpreter->addOperand(finalOp, Interpreter::okFPOUT, dimWanted);
+            returnSlot = finalOp;
+            interpreter->endOp();
+        }
+    }
+    return returnSlot;
+}
+
+void Expression::prepMultiple(const std::vector<const Expression*>& expressions) {
+    // one batch per compile profile
+    LLVMBatch batches[] = {LLVMBatch(FinalProfile), LLVMBatch(InteractiveProfile)};
+    std::vector<const Expression*> batched;
+    for (const Expression* e : expressions) {
+        if (e->_prepped || e->_evaluationStrategy != UseLLVM) continue;
+        e->_llvmBatch = &batches[e->_compileProfile];
+        e->prep();
+        e->_llvmBatch = nullptr;
+        if (e->_isValid) batched.push_back(e);
+    }
+    for (LLVMBatch& batch : batches) batch.compile();
+    for (const Expression* e : batched)
+        if (!e->_llvmEvaluator->prepared()) {
+            e->_isValid = false;
+            e->_returnType = ExprType().Error();
+        }
+    for (const Expression* e : expressions) e->prepIfNeeded();
+}
+
+bool Expression::writePrecompiled(const std::vector<Expression*>& expressions,
+                                  const std::string& objectPath,
+                                  const std::string& cpu,
+                                  std::string& error) {
+    LLVMBatch batch(FinalProfile, true);
+    for (Expression* e : expressions) {
+        e->reset();
+        e->_llvmBatch = &batch;
+        e->prep();
+        e->_llvmBatch = nullptr;
+        if (!e->_isValid || e->_evaluationStrategy != UseLLVM)
+            error += "'" + e->_expression + "' is not a valid expression evaluated with LLVM\n";
+    }
+    bool written = error.empty() && batch.writeObject(objectPath, cpu, error);
+    for (Expression* e : expressions) e->reset();
+    return written;
+}
+
 bool Expression::isVec() const {
     prepIfNeeded();
     return _isValid ? _parseTree->isVec() : _wantVec;
@@ -304,12 +600,24 @@ const ExprType& Expression::returnType() const {
     return _returnType;
 }
 
+void Expression::countTieredPoints(size_t points) const {
+#ifdef SEEXPR_ENABLE_LLVM
+    if (_evaluationStrategy != UseTiered || _tieredStarted.load(std::memory_order_relaxed)) return;
+    if (_tieredPoints.fetch_add(points) + points < tieredThreshold || _tieredStarted.exchange(true)) return;
+    // evaluation keeps using the interpreter (which doesn't touch the parse tree) until the code is ready
+    TieredCompiler::instance().enqueue(this, {_llvmEvaluator, _parseTree, _desiredReturnType,
+                                              _evaluationPrecision == UseFloat, _compileProfile, &_llvmReady});
+#endif
+}
+
 const double* Expression::evalFP(VarBlock* varBlock) const {
     prepIfNeeded();
     if (_isValid) {
-        if (_evaluationStrategy == UseInterpreter) {
-            _interpreter->eval(varBlock);
-            return (varBlock && varBlock->threadSafe) ? &(varBlock->d[_returnSlot]) : &_interpreter->d[_returnSlot];
+        if (!useLLVM()) {
+            countTieredPoints(1);
+            InterpreterFrame& frame = _interpreter->frame(varBlock);
+            _interpreter->eval(frame, varBlock);
+            return &frame.d[_returnSlot];
         } else {  // useLLVM
             return _llvmEvaluator->evalFP(varBlock);
         }
@@ -318,33 +626,125 @@ const double* Expression::evalFP(VarBlock* varBlock) const {
     return noCrash;
 }
 
+namespace {
+//! What evalMultiple writes of the result of an interpreted expression returning type from returnSlot
+Interpreter::Output interpreterOutput(int returnSlot, const ExprType& type, const ChannelFormat& format) {
+    if (type.isString()) return {returnSlot, Interpreter::okPTRIN, 1, ChannelFormat()};
+    return {returnSlot, Interpreter::okFPIN, type.dim(), format};
+}
+
+//! Position of the lowest set bit of a non zero word
+inline int lowestBit(uint64_t bits) {
+#if defined(WINDOWS) && defined(_MSC_VER)
+    unsigned long position;
+    _BitScanForward64(&position, bits);
+    return static_cast<int>(position);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+}
+
 void Expression::evalMultiple(VarBlock* varBlock, int outputVarBlockOffset, size_t rangeStart, size_t rangeEnd) const {
     prepIfNeeded();
     if (_isValid) {
-        if (_evaluationStrategy == UseInterpreter) {
-            // TODO: need strings to work
-            int dim = _desiredReturnType.dim();
-            // double* iHack=reinterpret_cast<double**>(varBlock->data())[outputVarBlockOffset];
-            double* destBase = reinterpret_cast<double**>(varBlock->data())[outputVarBlockOffset];
-            for (size_t i = rangeStart; i < rangeEnd; i++) {
-                varBlock->indirectIndex = static_cast<int>(i);
-                const double* f = evalFP(varBlock);
-                for (int k = 0; k < dim; k++) {
-                    destBase[dim * i + k] = f[k];
-                }
-            }
+        ChannelFormat format = _varBlockCreator ? _varBlockCreator->format(outputVarBlockOffset) : ChannelFormat();
+        if (!useLLVM()) {
+            countTieredPoints(rangeEnd - rangeStart);
+            _interpreter->evalMultiple(varBlock, {interpreterOutput(_returnSlot, _desiredReturnType, format)},
+                                       &outputVarBlockOffset, rangeStart, rangeEnd);
+        } else if (format.type != ChannelType::Native) {
+            _llvmEvaluator->evalMultiple(varBlock, outputVarBlockOffset, format, _desiredReturnType.dim(),
+                                         _evaluationPrecision == UseFloat, rangeStart, rangeEnd);
         } else {  // useLLVM
             _llvmEvaluator->evalMultiple(varBlock, outputVarBlockOffset, rangeStart, rangeEnd);
         }
     }
 }
 
+void Expression::evalMultipleParallel(VarBlock* varBlock, int outputVarBlockOffset, size_t rangeStart,
+                                      size_t rangeEnd) const {
+    prepIfNeeded();
+    ThreadPool& pool = ThreadPool::global();
+    // the strings of a string output must outlive the threads' working data, which only the serial path keeps
+    if (!_isValid || !isThreadSafe() || pool.numThreads() <= 1 || rangeEnd - rangeStart <= Interpreter::batchSize ||
+        _desiredReturnType.isString()) {
+        evalMultiple(varBlock, outputVarBlockOffset, rangeStart, rangeEnd);
+        return;
+    }
+
+    // chunks of whole batches, small enough to fit their variable data in a share of a typical L2 cache, and to leave
+    // several for every thread so that stealing can even out the work
+    const size_t chunkBytes = 128 * 1024, W = Interpreter::batchSize;
+    size_t grain = parallelGrain;
+    if (!grain) {
+        size_t scalarSize = _evaluationPrecision == UseFloat ? sizeof(float) : sizeof(double);
+        size_t dim = _desiredReturnType.dim() + (_varBlockCreator ? _varBlockCreator->varyingDim() : 0);
+        grain = std::min(chunkBytes / (scalarSize * dim), (rangeEnd - rangeStart) / (4 * pool.numThreads()));
+    }
+    grain = std::max((grain + W - 1) / W * W, W);
+
+    ChannelFormat format = _varBlockCreator ? _varBlockCreator->format(outputVarBlockOffset) : ChannelFormat();
+    if (!useLLVM()) {
+        countTieredPoints(rangeEnd - rangeStart);
+        std::vector<Interpreter::RangeFrame> frames(pool.numThreads());
+        std::vector<Interpreter::Output> outputs = {interpreterOutput(_returnSlot, _desiredReturnType, format)};
+        pool.parallelFor(rangeStart, rangeEnd, grain, [&](int worker, size_t chunkStart, size_t chunkEnd) {
+            _interpreter->evalMultiple(varBlock, frames[worker], outputs, &outputVarBlockOffset, chunkStart, chunkEnd);
+        });
+    } else if (format.type != ChannelType::Native) {
+        std::vector<StringArena> strings(pool.numThreads());
+        pool.parallelFor(rangeStart, rangeEnd, grain, [&](int worker, size_t chunkStart, size_t chunkEnd) {
+            _llvmEvaluator->evalMultiple(varBlock, outputVarBlockOffset, format, _desiredReturnType.dim(),
+                                         _evaluationPrecision == UseFloat, chunkStart, chunkEnd, strings[worker]);
+        });
+    } else {
+        std::vector<StringArena> strings(pool.numThreads());
+        pool.parallelFor(rangeStart, rangeEnd, grain, [&](int worker, size_t chunkStart, size_t chunkEnd) {
+            _llvmEvaluator->evalMultiple(varBlock, outputVarBlockOffset, chunkStart, chunkEnd, strings[worker]);
+        });
+    }
+}
+
+void Expression::evalMultipleIndexed(VarBlock* varBlock, int outputVarBlockOffset, const uint32_t* indices,
+                                     size_t numIndices) const {
+    prepIfNeeded();
+    if (_isValid) {
+        ChannelFormat format = _varBlockCreator ? _varBlockCreator->format(outputVarBlockOffset) : ChannelFormat();
+        if (!useLLVM()) {
+            countTieredPoints(numIndices);
+            _interpreter->evalMultiple(varBlock, {interpreterOutput(_returnSlot, _desiredReturnType, format)},
+                                       &outputVarBlockOffset, 0, numIndices, indices);
+        } else {  // useLLVM
+            _llvmEvaluator->evalIndexed(varBlock, outputVarBlockOffset, format, _desiredReturnType.dim(),
+                                        _evaluationPrecision == UseFloat, indices, numIndices);
+        }
+    }
+}
+
+void Expression::evalMultipleMasked(VarBlock* varBlock, int outputVarBlockOffset, const uint64_t* mask,
+                                    size_t rangeStart, size_t rangeEnd) const {
+    // all the points go into one evaluation: the strings it builds are only kept until the next one, and the uniform
+    // part of the program runs once
+    std::vector<uint32_t> indices;
+    for (size_t word = rangeStart / 64; rangeStart < rangeEnd && word * 64 < rangeEnd; word++) {
+        uint64_t bits = mask[word];
+        // drop the bits of the points outside the range
+        if (word == rangeStart / 64) bits &= ~uint64_t(0) << (rangeStart % 64);
+        if (word == (rangeEnd - 1) / 64 && rangeEnd % 64) bits &= ~(~uint64_t(0) << (rangeEnd % 64));
+        for (; bits; bits &= bits - 1) indices.push_back(static_cast<uint32_t>(word * 64 + lowestBit(bits)));
+    }
+    evalMultipleIndexed(varBlock, outputVarBlockOffset, indices.data(), indices.size());
+}
+
 const char* Expression::evalStr(VarBlock* varBlock) const {
     prepIfNeeded();
     if (_isValid) {
-        if (_evaluationStrategy == UseInterpreter) {
-            _interpreter->eval(varBlock);
-            return (varBlock && varBlock->threadSafe) ? varBlock->s[_returnSlot] : _interpreter->s[_returnSlot];
+        if (!useLLVM()) {
+            countTieredPoints(1);
+            InterpreterFrame& frame = _interpreter->frame(varBlock);
+            _interpreter->eval(frame, varBlock);
+            return frame.s[_returnSlot];
         } else {  // useLLVM
             return _llvmEvaluator->evalStr(varBlock);
         }
@@ -18,6 +18,7 @@
 #define Expression_h
 
 #include <string>
+#include <atomic>
 #include <map>
 #include <set>
 #include <vector>
@@ -66,26 +67,102 @@ class ExprVarRef {
     virtual void eval(double* result) = 0;
     virtual void eval(const char** resultStr) = 0;
 
+    //! Sets the values of an FP variable at n points at once, the dim values of the point at indices[i] (the index of
+    //! the point in the range evalMultiple evaluates) to result[i*dim]. evalMultiple calls it for a batch of points
+    //! rather than eval for each one (which single evaluations still call), so a variable can fetch them in one go.
+    //! Returns false if the variable has no batch fetch (the default): evalMultiple then calls eval for every point,
+    //! with the indirectIndex of the variable block set to the point.
+    virtual bool evalBatch(double* result, const int* indices, size_t n) {
+        return false;
+    }
+
   private:
     ExprType _type;
 };
 
 class LLVMEvaluator;
+class LLVMBatch;
 class VarBlock;
 class VarBlockCreator;
+class ExpressionGroup;
 
 /// main expression class
 class Expression {
+    friend class ExpressionGroup;  // builds the code of several prepared expressions
+    friend class LLVMBatch;        // counts its cache lookups
+
   public:
     //! Types of evaluation strategies that are available
     enum EvaluationStrategy {
         UseInterpreter,
-        UseLLVM
+        UseLLVM,
+        //! Starts in the interpreter and switches to LLVM code compiled in the background once tieredThreshold
+        //! points were evaluated (stays in the interpreter in builds without LLVM). One thread compiles the
+        //! expressions that got hot, those queued while it's busy together in one batch.
+        UseTiered
     };
     //! What evaluation strategy to use by default
     static EvaluationStrategy defaultEvaluationStrategy;
+    //! Points a UseTiered expression evaluates before it is compiled (defaults to SE_EXPR_TIERED_THRESHOLD or 100000)
+    static size_t tieredThreshold;
+    //! Points in a chunk of evalMultipleParallel (defaults to SE_EXPR_GRAIN). 0 sizes chunks so that the variable data
+    //! of a chunk stays in the cache while it's evaluated.
+    static size_t parallelGrain;
+    //! Precision of the variable block data and evalMultiple outputs. With UseFloat the FP variables of the
+    //! variable block point to float data and the output of evalMultiple is written as floats (evalFP still returns
+    //! doubles). This is mostly a storage format: the interpreter's batches keep operator results on float lanes, but
+    //! builtin (standard and noise) and custom function calls widen their arguments and compute in double, and LLVM
+    //! compiled code widens the data on load and computes in double like with UseDouble.
+    enum EvaluationPrecision {
+        UseDouble,
+        UseFloat
+    };
+    //! What precision to use by default (SE_EXPR_PRECISION=float selects UseFloat)
+    static EvaluationPrecision defaultEvaluationPrecision;
+    //! How much work LLVM puts into compiling. FinalProfile optimizes fully (level 3, vectorized, noise inlined) for
+    //! the host's cpu, InteractiveProfile compiles quickly (level 1, no vectorizers, generic cpu) for expressions that
+    //! are being edited.
+    enum CompileProfile {
+        FinalProfile,
+        InteractiveProfile
+    };
+    //! What compile profile to use by default (SE_EXPR_COMPILE_PROFILE=interactive selects InteractiveProfile)
+    static CompileProfile defaultCompileProfile;
+    //! Seconds an LLVM compile spent in each phase (expressions compiled together share their compile)
+    struct CompileTimings {
+        double irGeneration = 0;    //!< generating and verifying the IR
+        double optimization = 0;    //!< running the optimization passes
+        double codeGeneration = 0;  //!< generating the machine code (or loading it from the cache)
+    };
     //! Whether to debug expressions
     static bool debugging;
+    //! Directory where the machine code of LLVM compiled expressions is kept across runs, so compiling the same
+    //! expression again (whatever it is compiled together with) only loads it (defaults to SE_EXPR_CACHE_DIR, empty
+    //! disables the cache). Expressions reading host variables aren't cached.
+    static void setLLVMCacheDirectory(const std::string& directory);
+    static std::string llvmCacheDirectory();
+    //! Number of expressions (and groups) compiled with LLVM whose machine code was loaded from the cache directory
+    //! and that had to be compiled
+    static size_t llvmCacheHits();
+    static size_t llvmCacheMisses();
+    //! The cpu and the features enabled for it that LLVM generates code for (in the final profile), e.g. to log on
+    //! which instruction sets a farm node runs expressions. Features above the level selected for the library's
+    //! kernels (see CPUDispatch.h) are left off. Empty without LLVM.
+    static std::string llvmTarget();
+    //! Loads a library written by the precompile utility. Expressions evaluated with UseLLVM or UseTiered (given to
+    //! the constructor or as defaultEvaluationStrategy) whose text, return type, precision, variable block layout and
+    //! standard functions match one it holds run its code rather than being compiled, also in builds without LLVM,
+    //! unless the cpu it was compiled for needs an instruction set level above the selected one (see CPUDispatch.h).
+    //! Interpreted expressions don't use it. Returns false (printing why) if it can't be loaded.
+    static bool loadPrecompiled(const std::string& path);
+    //! Writes the machine code of the expressions (evaluated with LLVM) to an object file for cpu (a generic one of
+    //! the architecture if empty, the host's with the features LLVM would use if "host"), for the precompile utility
+    //! to link into a library. Returns false, appending the reasons to error, if any of them can't be precompiled.
+    //! The expressions are reset afterwards.
+    static bool writePrecompiled(const std::vector<Expression*>& expressions,
+                                 const std::string& objectPath,
+                                 const std::string& cpu,
+                                 std::string& error);
 
     // typedef std::map<std::string, ExprLocalVarRef> LocalVarTable;
 
@@ -197,12 +274,29 @@ class Expression {
     /// Evaluate multiple blocks
     void evalMultiple(VarBlock* varBlock, int outputVarBlockOffset, size_t rangeStart, size_t rangeEnd) const;
 
+    /// evalMultiple with the range split into chunks evaluated in parallel on the library's thread pool (see
+    /// ThreadPool::global, SE_EXPR_THREADS sets its size). Each thread works on its own data, so a single variable
+    /// block (thread safe or not) serves them all. Returns when every point is done. An expression calling functions
+    /// that aren't thread safe is evaluated serially; variable references of the host must be thread safe.
+    void evalMultipleParallel(VarBlock* varBlock, int outputVarBlockOffset, size_t rangeStart, size_t rangeEnd) const;
+
+    /// evalMultiple of just the numIndices points listed in indices (in any order, none twice), e.g. the ones that
+    /// survived culling. Only their outputs are written, at their own positions in the output variable.
+    void evalMultipleIndexed(VarBlock* varBlock, int outputVarBlockOffset, const uint32_t* indices,
+                             size_t numIndices) const;
+
+    /// evalMultiple of the points of [rangeStart,rangeEnd) whose bit is set in mask (bit i%64 of mask[i/64] for
+    /// point i), leaving the outputs of the others alone
+    void evalMultipleMasked(VarBlock* varBlock, int outputVarBlockOffset, const uint64_t* mask, size_t rangeStart,
+                            size_t rangeEnd) const;
+
     // TODO: make this deprecated
     /** Evaluates and returns float (check returnType()!) */
     const double* evalFP(VarBlock* varBlock = nullptr) const;
 
     // TODO: make this deprecated
-    /** Evaluates and returns string (check returnType()!) */
+    /** Evaluates and returns string (check returnType()!). The string stays valid until the expression is evaluated
+        again (with the same thread safe varBlock, for the interpreter). */
     const char* evalStr(VarBlock* varBlock = nullptr) const;
 
     /** Reset expr - force reparse/rebind */
@@ -238,19 +332,43 @@ class Expression {
     /** Debug printout of LLVM evaluation  **/
     void debugPrintLLVM() const;
 
+    /** The optimized LLVM IR of the expression's code, kept if it was compiled while debugging (empty if not, or
+        if the code was loaded from the cache) **/
+    std::string llvmIR() const;
+
     /** Set variable block creator (lifetime of expression must be <= block) **/
     void setVarBlockCreator(const VarBlockCreator* varBlockCreator);
 
     const VarBlockCreator* varBlockCreator() const { return _varBlockCreator; }
 
+    /** Set the precision of the variable block data and evalMultiple outputs **/
+    void setEvaluationPrecision(EvaluationPrecision precision);
+
+    EvaluationPrecision evaluationPrecision() const { return _evaluationPrecision; }
+
+    /** Set how much work LLVM puts into compiling the expression **/
+    void setCompileProfile(CompileProfile profile);
+
+    CompileProfile compileProfile() const { return _compileProfile; }
+
+    /** Timings of the expression's LLVM compile, all zero until its LLVM code is used (and for precompiled code) **/
+    CompileTimings compileTimings() const;
+
   private:
     /** No definition by design. */
     Expression(const Expression& e);
     Expression& operator=(const Expression& e);
 
+    /** Records the outcome of a lookup in the LLVM cache directory (see llvmCacheHits) */
+    static void countLLVMCacheLookup(bool hit);
+
     /** Parse, and remember parse error if any */
     void parse() const;
 
+    /** Prepares the expressions, compiling the ones evaluated with LLVM together: one module, optimization pass and
+        JIT engine shared by all of them, which is faster and uses less memory than preparing them one at a time */
+    static void prepMultiple(const std::vector<const Expression*>& expressions);
+
     /** Parse, but only if not yet parsed */
     void parseIfNeeded() const {
         if (!_parsed) parse();
@@ -260,6 +378,10 @@ class Expression {
     and remember error if any */
     void prep() const;
 
+    /** Promotes the result the interpreter program being built computes at returnSlot to the desired return type,
+        returns its slot */
+    int buildInterpreterResult(Interpreter* interpreter, int returnSlot) const;
+
     /** True if the expression wants a vector */
     bool _wantVec;
 
@@ -271,6 +393,11 @@ class Expression {
 
     EvaluationStrategy _evaluationStrategy;
 
+    EvaluationPrecision _evaluationPrecision = defaultEvaluationPrecision;
+
+    /** LLVM compile profile */
+    CompileProfile _compileProfile = defaultCompileProfile;
+
     /** Context for out of band function parameters */
     const Context* _context;
 
@@ -324,6 +451,25 @@ class Expression {
 
     // LLVM evaluation layer
     mutable LLVMEvaluator* _llvmEvaluator;
+    // Batch the expression is compiled with during prepMultiple
+    mutable LLVMBatch* _llvmBatch = nullptr;
+
+    // Tiered evaluation: points evaluated so far, whether the background compile was queued and whether its code
+    // replaced the interpreter
+    mutable std::atomic<size_t> _tieredPoints{0};
+    mutable std::atomic<bool> _tieredStarted{false};
+    mutable std::atomic<bool> _llvmReady{false};
+
+    /** Whether evaluation runs the LLVM code */
+    bool useLLVM() const {
+        return _evaluationStrategy == UseLLVM || _llvmReady.load(std::memory_order_acquire);
+    }
+
+    /** Sets the LLVM evaluator up with code from a loaded precompiled library, if one has this expression */
+    bool bindPrecompiled() const;
+
+    /** Counts points evaluated by a tiered expression, starting its compile when they reach tieredThreshold */
+    void countTieredPoints(size_t points) const;
 
     // Var block creator
     const VarBlockCreator* _varBlockCreator = 0;
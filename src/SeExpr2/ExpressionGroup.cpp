@@ -0,0 +1,151 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#include "ExpressionGroup.h"
+#include "ExprNode.h"
+#include "Evaluator.h"
+#include "VarBlock.h"
+
+namespace SeExpr2 {
+
+ExpressionGroup::ExpressionGroup() {}
+
+ExpressionGroup::~ExpressionGroup() {}
+
+void ExpressionGroup::add(const Expression* expression, int outputVarBlockOffset) {
+    _members.push_back({expression, outputVarBlockOffset});
+    reset();
+}
+
+bool ExpressionGroup::isValid() const {
+    prepIfNeeded();
+    return _isValid;
+}
+
+size_t ExpressionGroup::numFused() const {
+    prepIfNeeded();
+    return _fused.size();
+}
+
+void ExpressionGroup::reset() {
+    _prepped = _isValid = false;
+    _fused.clear();
+    _separate.clear();
+    _fusedOffsets.clear();
+    _interpreter.reset();
+    _outputs.clear();
+    _llvmEvaluator.reset();
+}
+
+void ExpressionGroup::prep() const {
+    _prepped = true;
+    std::vector<const Expression*> expressions;
+    for (const Member& member : _members) expressions.push_back(member.expression);
+    Expression::prepMultiple(expressions);
+
+    // the members computing fp values like the first one are fused
+    _isValid = true;
+    const Expression* first = nullptr;
+    bool llvm = true;
+    for (size_t i = 0; i < _members.size(); i++) {
+        const Expression* e = _members[i].expression;
+        _isValid = _isValid && e->_isValid;
+        if (!e->_isValid) continue;
+        if (!first && e->_desiredReturnType.isFP()) first = e;
+        // the group loop of compiled code writes natively, converting outputs is left to the expression's own
+        bool convertedOutput = e->_evaluationStrategy == Expression::UseLLVM &&
+                               outputFormat(_members[i]).type != ChannelType::Native;
+        if (first && e->_desiredReturnType.isFP() && e->_evaluationPrecision == first->_evaluationPrecision &&
+            e->_varBlockCreator == first->_varBlockCreator && !convertedOutput) {
+            _fused.push_back(i);
+            _fusedOffsets.push_back(_members[i].outputVarBlockOffset);
+            llvm = llvm && e->_evaluationStrategy == Expression::UseLLVM;
+        } else {
+            _separate.push_back(i);
+        }
+    }
+    if (_fused.empty()) return;
+    bool singlePrecision = first->_evaluationPrecision == Expression::UseFloat;
+
+    if (llvm) {
+        LLVMBatch batch(first->_compileProfile);
+        std::vector<std::pair<ExprNode*, ExprType>> trees;
+        for (size_t i : _fused) {
+            const Expression* e = _members[i].expression;
+            trees.push_back(std::make_pair(e->_parseTree, e->_desiredReturnType));
+        }
+        _llvmEvaluator.reset(new LLVMEvaluator);
+        batch.addGroup(_llvmEvaluator.get(), trees, singlePrecision);
+        batch.compile();
+        if (!_llvmEvaluator->prepared()) {
+            // the members still run their own code
+            _llvmEvaluator.reset();
+            _separate.insert(_separate.end(), _fused.begin(), _fused.end());
+            _fused.clear();
+            _fusedOffsets.clear();
+        }
+        return;
+    }
+
+    // every member's local functions go before the start of the program, then their bodies follow one another
+    _interpreter.reset(new Interpreter(singlePrecision));
+    bool constant = true;
+    for (size_t i : _fused)
+        static_cast<const ExprModuleNode*>(_members[i].expression->_parseTree)
+            ->buildInterpreterForFunctions(_interpreter.get());
+    _interpreter->setPCStart(_interpreter->nextPC());
+    for (size_t i : _fused) {
+        const Expression* e = _members[i].expression;
+        int slot = static_cast<const ExprModuleNode*>(e->_parseTree)->buildInterpreterForBody(_interpreter.get());
+        _outputs.push_back({e->buildInterpreterResult(_interpreter.get(), slot), Interpreter::okFPIN,
+                            e->_desiredReturnType.dim(), outputFormat(_members[i])});
+        constant = constant && e->_parseTree->type().isLifetimeConstant();
+    }
+    _interpreter->finalize(_outputs, constant);
+    if (Expression::debugging) _interpreter->print();
+}
+
+ChannelFormat ExpressionGroup::outputFormat(const Member& member) {
+    const VarBlockCreator* creator = member.expression->_varBlockCreator;
+    return creator ? creator->format(member.outputVarBlockOffset) : ChannelFormat();
+}
+
+void ExpressionGroup::evalMultiple(VarBlock* varBlock, size_t rangeStart, size_t rangeEnd) const {
+    prepIfNeeded();
+    if (_interpreter)
+        _interpreter->evalMultiple(varBlock, _outputs, _fusedOffsets.data(), rangeStart, rangeEnd);
+    else if (_llvmEvaluator)
+        _llvmEvaluator->evalGroup(varBlock, _fusedOffsets.data(), static_cast<uint32_t>(rangeStart),
+                                  static_cast<uint32_t>(rangeEnd));
+    for (size_t i : _separate)
+        _members[i].expression->evalMultiple(varBlock, _members[i].outputVarBlockOffset, rangeStart, rangeEnd);
+}
+
+void ExpressionGroup::evalMultipleIndexed(VarBlock* varBlock, const uint32_t* indices, size_t numIndices) const {
+    prepIfNeeded();
+    if (_interpreter)
+        _interpreter->evalMultiple(varBlock, _outputs, _fusedOffsets.data(), 0, numIndices, indices);
+    else if (_llvmEvaluator)
+        _llvmEvaluator->evalGroupIndexed(varBlock, _fusedOffsets.data(), indices, numIndices);
+    for (size_t i : _separate)
+        _members[i].expression->evalMultipleIndexed(varBlock, _members[i].outputVarBlockOffset, indices, numIndices);
+}
+
+void ExpressionGroup::debugPrintInterpreter() const {
+    prepIfNeeded();
+    if (_interpreter) _interpreter->print();
+}
+}
@@ -0,0 +1,98 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#ifndef ExpressionGroup_h
+#define ExpressionGroup_h
+
+#include <memory>
+#include <vector>
+
+#include "Expression.h"
+#include "Interpreter.h"
+
+namespace SeExpr2 {
+
+/// Evaluates several expressions reading the same variable block over a range of points in one pass, each into its
+/// own output variable. The expressions are compiled into a single interpreter program (with the ops they have in
+/// common computed once) or, when they are all evaluated with LLVM, a single loop function, so the variables they
+/// share are loaded and their common subexpressions computed once per point rather than once per expression.
+class ExpressionGroup {
+  public:
+    ExpressionGroup();
+    ~ExpressionGroup();
+
+    /** Adds expression, whose results evalMultiple writes to the output variable at outputVarBlockOffset. The
+        expression must outlive the group, and the group must be reset when the expression changes. */
+    void add(const Expression* expression, int outputVarBlockOffset);
+
+    /** Number of expressions added */
+    size_t size() const { return _members.size(); }
+
+    /** Whether all the expressions are valid. The group is prepared if needed. */
+    bool isValid() const;
+
+    /** Number of expressions evaluated by the group's combined code. The others (e.g. ones returning strings or
+        evaluated with another precision or variable block layout than the first) are evaluated one at a time. */
+    size_t numFused() const;
+
+    /** Evaluates every expression for the points [rangeStart,rangeEnd) of varBlock */
+    void evalMultiple(VarBlock* varBlock, size_t rangeStart, size_t rangeEnd) const;
+
+    /** Evaluates every expression for just the numIndices points of varBlock listed in indices (see
+        Expression::evalMultipleIndexed) */
+    void evalMultipleIndexed(VarBlock* varBlock, const uint32_t* indices, size_t numIndices) const;
+
+    /** Forgets the combined code, which is built again when next needed */
+    void reset();
+
+    /** Debug printout of the combined interpreter program */
+    void debugPrintInterpreter() const;
+
+  private:
+    /** No definition by design. */
+    ExpressionGroup(const ExpressionGroup&);
+    ExpressionGroup& operator=(const ExpressionGroup&);
+
+    /** Prepares the expressions and builds the combined code */
+    void prep() const;
+
+    void prepIfNeeded() const {
+        if (!_prepped) prep();
+    }
+
+    struct Member {
+        const Expression* expression;
+        int outputVarBlockOffset;
+    };
+    std::vector<Member> _members;
+    /** Layout of the output variable of member */
+    static ChannelFormat outputFormat(const Member& member);
+
+    mutable bool _prepped = false, _isValid = false;
+    /** Members evaluated by the combined code and the offsets of their outputs, the others */
+    mutable std::vector<size_t> _fused, _separate;
+    mutable std::vector<int> _fusedOffsets;
+
+    /** The combined program and where it leaves the results of the fused members */
+    mutable std::unique_ptr<Interpreter> _interpreter;
+    mutable std::vector<Interpreter::Output> _outputs;
+
+    /** The combined LLVM loop function */
+    mutable std::unique_ptr<LLVMEvaluator> _llvmEvaluator;
+};
+}
+
+#endif
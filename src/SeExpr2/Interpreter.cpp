@@ -15,12 +15,17 @@
  http://www.apache.org/licenses/LICENSE-2.0
 */
 #include "ExprNode.h"
+#include "ExprFuncX.h"
 #include "Interpreter.h"
 #include "VarBlock.h"
 #include "Platform.h"
 #include <iostream>
 #include <cstdio>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <atomic>
+#include <limits>
 #if !defined(WINDOWS)
 #include <dlfcn.h>
 #endif
@@ -28,58 +33,314 @@
 // TODO: optimize to write to location directly on a CondNode
 namespace SeExpr2 {
 
-void Interpreter::eval(VarBlock* block, bool debug) {
-    // get pointers to the working data
-    double* fp = d.data();
-    char** str = s.data();
+bool Interpreter::fuseOps = !getenv("SE_EXPR_FUSE") || strcmp(getenv("SE_EXPR_FUSE"), "0") != 0;
+bool Interpreter::reuseSlots = !getenv("SE_EXPR_REUSE_SLOTS") || strcmp(getenv("SE_EXPR_REUSE_SLOTS"), "0") != 0;
+bool Interpreter::hoistUniform = !getenv("SE_EXPR_HOIST_UNIFORM") || strcmp(getenv("SE_EXPR_HOIST_UNIFORM"), "0") != 0;
+bool Interpreter::foldConstants = !getenv("SE_EXPR_FOLD") || strcmp(getenv("SE_EXPR_FOLD"), "0") != 0;
+bool Interpreter::eliminateCommon = !getenv("SE_EXPR_CSE") || strcmp(getenv("SE_EXPR_CSE"), "0") != 0;
 
-    // if we have a VarBlock instance, we need to update the working data
-    if (block) {
-        // if the VarBlock is flagged as thread safe, copy the interpreter's data to it.
-        if (block->threadSafe == true) {
-            // copy double data
-            block->d.resize(d.size());
-            fp = block->d.data();
-            memcpy(fp, d.data(), d.size() * sizeof(double));
+size_t Interpreter::newId() {
+    static std::atomic<size_t> lastId(0);
+    return ++lastId;
+}
 
-            // copy string data
-            block->s.resize(s.size());
-            str = block->s.data();
-            memcpy(str, s.data(), s.size() * sizeof(char*));
+InterpreterFrame& Interpreter::frame(VarBlock* block) const {
+    if (!block || !block->threadSafe) return _frame;
+    if (!block->frames) block->frames = std::make_shared<InterpreterFrames>();
+    auto& frames = block->frames->frames;
+    std::unique_ptr<InterpreterFrame>& frame = frames[_id];
+    if (!frame) {
+        frame.reset(new InterpreterFrame);
+        // make room by dropping the frame of the least recently used program
+        if (frames.size() > InterpreterFrames::maxPrograms) {
+            auto oldest = frames.end();
+            for (auto it = frames.begin(); it != frames.end(); ++it)
+                if (it->first != _id && (oldest == frames.end() || it->second->lastUse < oldest->second->lastUse))
+                    oldest = it;
+            frames.erase(oldest);
         }
+    }
+    frame->lastUse = ++block->frames->uses;
+    return *frame;
+}
+
+void Interpreter::setUp(InterpreterFrame& frame) const {
+    // the frame is set up once per program, later evaluations reuse it as is
+    if (frame.program != _id) {
+        frame.d = d;
+        frame.s = s;
+        frame.callStack.assign(_callDepth + 1, 0);
+        frame.program = _id;
+    }
+}
+
+void Interpreter::eval(InterpreterFrame& frame, VarBlock* block, bool debug) const {
+    setUp(frame);
+    char** str = frame.s.data();
 
-        // set the variable evaluation data
+    // set the variable evaluation data
+    if (block) {
         str[0] = reinterpret_cast<char*>(block->data());
         str[1] = reinterpret_cast<char*>(static_cast<size_t>(block->indirectIndex));
     }
+    str[stringArenaSlot] = reinterpret_cast<char*>(&frame.strings);
+    frame.strings.reset();
 
-    int pc = _pcStart;
-    int end = static_cast<int>(ops.size());
-    while (pc < end) {
+    run(frame.d.data(), str, frame.callStack, _pcStart, _varyingStart, debug);
+    frame.varyingStrings = frame.strings.mark();
+    run(frame.d.data(), str, frame.callStack, _varyingStart, static_cast<int>(ops.size()), debug);
+}
+
+void Interpreter::run(double* fp, char** str, std::vector<int>& callStack, int pcBegin, int pcEnd,
+                      bool debug) const {
+    assert(!_codePC.empty() && "program evaluated before finalize");
+
+    // direct threaded dispatch: falling through moves to the next record, jumps go through the pc table
+    const int* code = _code.data();
+    const int* codePC = _codePC.data();
+    const int* ip = code + codePC[pcBegin];
+    const int* end = code + codePC[pcEnd];
+    while (ip < end) {
         if (debug) {
-            std::cerr << "Running op at " << pc << std::endl;
-            print(pc);
+            std::cerr << "Running op at " << ip[codeHandlerWords + 1] << std::endl;
+            print(ip[codeHandlerWords + 1]);
+        }
+        OpF op;
+        memcpy(&op, ip, sizeof(OpF));
+        int next = op(const_cast<int*>(ip) + codeHeaderWords, fp, str, callStack);
+        ip = next == 1 ? ip + ip[codeHandlerWords] : code + codePC[ip[codeHandlerWords + 1] + next];
+    }
+}
+
+void Interpreter::link() {
+    _code.clear();
+    _codePC.clear();
+    for (int pc = 0; pc < static_cast<int>(ops.size()); pc++) {
+        int begin = ops[pc].second, end = opDataEnd(pc);
+        int size = codeHeaderWords + end - begin;
+        size = (size + codeHandlerWords - 1) / codeHandlerWords * codeHandlerWords;
+        int at = static_cast<int>(_code.size());
+        _codePC.push_back(at);
+        _code.resize(at + size);
+        memcpy(&_code[at], &ops[pc].first, sizeof(OpF));
+        _code[at + codeHandlerWords] = size;
+        _code[at + codeHandlerWords + 1] = pc;
+        std::copy(opData.begin() + begin, opData.begin() + end, _code.begin() + at + codeHeaderWords);
+    }
+    _codePC.push_back(static_cast<int>(_code.size()));
+}
+
+//! Working data of evalMultiple. The batch frame holds batchSize lanes of every slot of d (as T) and s, the lane frame
+//! is a scalar frame used to run ops without a batch kernel one lane at a time. The uniform prologue is run when the
+//! frame is started, varyingStrings marks the strings it left. Ops run one lane at a time set the indirectIndex of
+//! block (if any) to the lane's point.
+template <class T>
+struct InterpreterBatchFrame {
+    std::vector<T> fp;
+    std::vector<char*> str;
+    std::vector<double> laneFp;
+    std::vector<char*> laneStr;
+    std::vector<int> callStack;
+    StringArena strings;
+    StringArena::Mark varyingStrings;
+    bool started = false;
+    VarBlock* block = nullptr;
+};
+
+InterpreterFrame::InterpreterFrame() {}
+
+InterpreterFrame::~InterpreterFrame() {}
+
+namespace {
+//! Whether evaluating a range of points into outputs must keep the strings built for every point (until the next
+//! evaluation with the frame) rather than just those of the point being evaluated
+bool keepsStrings(const std::vector<Interpreter::Output>& outputs) {
+    for (const Interpreter::Output& output : outputs)
+        if (output.kind == Interpreter::okPTRIN) return true;
+    return false;
+}
+}
+
+Interpreter::RangeFrame::RangeFrame() {}
+
+Interpreter::RangeFrame::~RangeFrame() {}
+
+void Interpreter::evalMultiple(VarBlock* block, const std::vector<Output>& outputs, const int* outputVarBlockOffsets,
+                               size_t rangeStart, size_t rangeEnd, const uint32_t* indices) const {
+    if (!_batchable) {
+        bool started = false;
+        evalPoints(frame(block), started, block, true, outputs, outputVarBlockOffsets, rangeStart, rangeEnd, indices);
+    } else if (_singlePrecision) {
+        evalBatches(startBatch(frame(block).floatBatch, block), block->data(), outputs, outputVarBlockOffsets,
+                    rangeStart, rangeEnd, indices);
+    } else {
+        evalBatches(startBatch(frame(block).batch, block), block->data(), outputs, outputVarBlockOffsets, rangeStart,
+                    rangeEnd, indices);
+    }
+}
+
+template <class T>
+Interpreter::BatchFrame<T>& Interpreter::startBatch(std::unique_ptr<BatchFrame<T>>& frame, VarBlock* block) const {
+    if (!frame) frame.reset(new BatchFrame<T>);
+    // the lanes are kept, but the uniform variables may have changed since the last evaluation
+    frame->started = false;
+    frame->block = block;
+    return *frame;
+}
+
+void Interpreter::evalMultiple(VarBlock* block, RangeFrame& frame, const std::vector<Output>& outputs,
+                               const int* outputVarBlockOffsets, size_t rangeStart, size_t rangeEnd,
+                               const uint32_t* indices) const {
+    if (!_batchable) {
+        evalPoints(frame.scalar, frame.started, block, false, outputs, outputVarBlockOffsets, rangeStart, rangeEnd,
+                   indices);
+    } else if (_singlePrecision) {
+        if (!frame.floatBatch) frame.floatBatch.reset(new BatchFrame<float>);
+        evalBatches(*frame.floatBatch, block->data(), outputs, outputVarBlockOffsets, rangeStart, rangeEnd, indices);
+    } else {
+        if (!frame.batch) frame.batch.reset(new BatchFrame<double>);
+        evalBatches(*frame.batch, block->data(), outputs, outputVarBlockOffsets, rangeStart, rangeEnd, indices);
+    }
+}
+
+void Interpreter::evalPoints(InterpreterFrame& frame, bool& started, VarBlock* block, bool setIndex,
+                             const std::vector<Output>& outputs, const int* outputVarBlockOffsets, size_t rangeStart,
+                             size_t rangeEnd, const uint32_t* indices) const {
+    // the uniform prologue runs once, then just the varying body for every point
+    char** data = block->data();
+    int end = static_cast<int>(ops.size());
+    bool keepStrings = keepsStrings(outputs);
+    for (size_t position = rangeStart; position < rangeEnd; position++) {
+        size_t i = indices ? indices[position] : position;
+        if (setIndex) block->indirectIndex = static_cast<int>(i);
+        if (!started) {
+            setUp(frame);
+            frame.s[0] = reinterpret_cast<char*>(data);
+            frame.s[1] = reinterpret_cast<char*>(i);
+            frame.s[stringArenaSlot] = reinterpret_cast<char*>(&frame.strings);
+            frame.strings.reset();
+            run(frame.d.data(), frame.s.data(), frame.callStack, _pcStart, _varyingStart, false);
+            frame.varyingStrings = frame.strings.mark();
+            started = true;
+        } else {
+            frame.s[1] = reinterpret_cast<char*>(i);
+            if (!keepStrings) frame.strings.release(frame.varyingStrings);
+        }
+        run(frame.d.data(), frame.s.data(), frame.callStack, _varyingStart, end, false);
+        for (size_t o = 0; o < outputs.size(); o++) {
+            if (outputs[o].kind == okPTRIN) {
+                reinterpret_cast<char***>(data)[outputVarBlockOffsets[o]][i] = frame.s[outputs[o].slot];
+                continue;
+            }
+            const double* f = &frame.d[outputs[o].slot];
+            int dim = outputs[o].dim;
+            if (outputs[o].format.type != ChannelType::Native) {
+                storeChannel(outputs[o].format, data[outputVarBlockOffsets[o]], i, 1, dim, f, 1, dim);
+                continue;
+            }
+            double* destBase = reinterpret_cast<double**>(data)[outputVarBlockOffsets[o]];
+            float* floatDestBase = reinterpret_cast<float**>(data)[outputVarBlockOffsets[o]];
+            for (int k = 0; k < dim; k++)
+                if (_singlePrecision)
+                    floatDestBase[dim * i + k] = static_cast<float>(f[k]);
+                else
+                    destBase[dim * i + k] = f[k];
+        }
+    }
+}
+
+template <class T>
+void Interpreter::evalBatches(BatchFrame<T>& frame, char** data, const std::vector<Output>& outputs,
+                              const int* outputVarBlockOffsets, size_t rangeStart, size_t rangeEnd,
+                              const uint32_t* indices) const {
+    const int W = batchSize;
+    int end = static_cast<int>(ops.size());
+    bool keepStrings = keepsStrings(outputs);
+    if (rangeStart >= rangeEnd) return;
+    if (!frame.started) {
+        // run the uniform prologue once on the scalar frame, every lane of the batch frame starts from its results
+        frame.laneFp = d;
+        frame.laneStr = s;
+        frame.laneStr[0] = reinterpret_cast<char*>(data);
+        frame.laneStr[1] = reinterpret_cast<char*>(static_cast<size_t>(indices ? indices[rangeStart] : rangeStart));
+        frame.laneStr[stringArenaSlot] = reinterpret_cast<char*>(&frame.strings);
+        frame.callStack.assign(_callDepth + 1, 0);
+        frame.strings.reset();
+        run(frame.laneFp.data(), frame.laneStr.data(), frame.callStack, _pcStart, _varyingStart, false);
+        frame.varyingStrings = frame.strings.mark();
+        frame.fp.resize(d.size() * W);
+        frame.str.resize(s.size() * W);
+        for (size_t k = 0; k < d.size(); k++) std::fill_n(&frame.fp[k * W], W, static_cast<T>(frame.laneFp[k]));
+        for (size_t k = 0; k < s.size(); k++) std::fill_n(&frame.str[k * W], W, frame.laneStr[k]);
+        frame.started = true;
+    }
+
+    for (size_t start = rangeStart; start < rangeEnd; start += W) {
+        int numLanes = static_cast<int>(std::min(rangeEnd - start, static_cast<size_t>(W)));
+        // the lane indices are what the variable loads gather with
+        if (indices)
+            for (int l = 0; l < numLanes; l++)
+                frame.str[W + l] = reinterpret_cast<char*>(static_cast<size_t>(indices[start + l]));
+        else
+            for (int l = 0; l < numLanes; l++) frame.str[W + l] = reinterpret_cast<char*>(start + l);
+        if (!keepStrings) frame.strings.release(frame.varyingStrings);
+        evalBatch(_varyingStart, end, frame, nullptr, numLanes);
+        // and the outputs are scattered to them
+        const uint32_t* points = indices ? indices + start : nullptr;
+        for (size_t o = 0; o < outputs.size(); o++) {
+            int slot = outputs[o].slot, dim = outputs[o].dim;
+            if (outputs[o].kind == okPTRIN) {
+                char** dest = reinterpret_cast<char***>(data)[outputVarBlockOffsets[o]];
+                if (points)
+                    for (int l = 0; l < numLanes; l++) dest[points[l]] = frame.str[slot * W + l];
+                else
+                    std::copy_n(&frame.str[slot * W], numLanes, dest + start);
+                continue;
+            }
+            if (outputs[o].format.type != ChannelType::Native) {
+                char* dest = data[outputVarBlockOffsets[o]];
+                if (points)
+                    for (int l = 0; l < numLanes; l++)
+                        storeChannel(outputs[o].format, dest, points[l], 1, dim, &frame.fp[slot * W + l], W, 1);
+                else
+                    storeChannel(outputs[o].format, dest, start, numLanes, dim, &frame.fp[slot * W], W, 1);
+                continue;
+            }
+            T* destBase = reinterpret_cast<T**>(data)[outputVarBlockOffsets[o]];
+            for (int l = 0; l < numLanes; l++) {
+                T* dest = destBase + dim * (points ? points[l] : start + l);
+                for (int k = 0; k < dim; k++) dest[k] = frame.fp[(slot + k) * W + l];
+            }
         }
-        const std::pair<OpF, int>& op = ops[pc];
-        int* opCurr = &opData[0] + op.second;
-        pc += op.first(opCurr, fp, str, callStack);
     }
 }
 
 void Interpreter::print(int pc) const {
     std::cerr << "---- ops     ----------------------" << std::endl;
-    for (size_t i = 0; i < ops.size(); i++) {
+    for (int i = 0; i < static_cast<int>(ops.size()); i++) {
+        if (i == _varyingStart && _varyingStart > _pcStart)
+            std::cerr << "---- varying ----------------------" << std::endl;
+        // show the linked record once the program is linked, the op being built otherwise
+        OpF op = ops[i].first;
+        const int* operands = &opData[ops[i].second];
+        bool linked = !_codePC.empty();
+        if (linked) {
+            memcpy(&op, &_code[_codePC[i]], sizeof(OpF));
+            operands = &_code[_codePC[i] + codeHeaderWords];
+        }
         const char* name = "";
 #if !defined(WINDOWS)
         Dl_info info;
-        if (dladdr((void*)ops[i].first, &info)) name = info.dli_sname;
+        if (dladdr((void*)op, &info)) name = info.dli_sname;
 #endif
-        fprintf(stderr, "%s %s %p (", pc == (int)i ? "-->" : "   ", name, ops[i].first);
-        int nextGuy = (i == ops.size() - 1 ? static_cast<int>(opData.size()) : ops[i + 1].second);
-        for (int k = ops[i].second; k < nextGuy; k++) {
-            fprintf(stderr, " %d", opData[k]);
+        fprintf(stderr, "%s %s %p (", pc == i ? "-->" : "   ", name, op);
+        for (int k = 0; k < opDataEnd(i) - ops[i].second; k++) {
+            fprintf(stderr, " %d", operands[k]);
         }
-        fprintf(stderr, ")\n");
+        if (linked)
+            fprintf(stderr, ") @%d\n", _codePC[i]);
+        else
+            fprintf(stderr, ")\n");
     }
     std::cerr << "---- opdata  ----------------------" << std::endl;
     for (size_t k = 0; k < opData.size(); k++) {
@@ -94,8 +355,9 @@ void Interpreter::print(int pc) const {
     std::cerr << "---- str     ----------------------" << std::endl;
     std::cerr << "s[0] reserved for datablock = " << reinterpret_cast<size_t>(s[0]) << std::endl;
     std::cerr << "s[1] is indirectIndex = " << reinterpret_cast<size_t>(s[1]) << std::endl;
-    for (size_t k = 2; k < s.size(); k++) {
-        std::cerr << "s[" << k << "]= 0x" << s[k];
+    std::cerr << "s[2] reserved for string arena" << std::endl;
+    for (size_t k = reservedPtrSlots; k < s.size(); k++) {
+        std::cerr << "s[" << k << "]= " << static_cast<const void*>(s[k]);
         if (s[k]) std::cerr << " '" << s[k][0] << s[k][1] << s[k][2] << s[k][3] << "...'";
         std::cerr << std::endl;
     }
@@ -149,38 +411,57 @@ static Interpreter::OpF getTemplatizedOp2(int i) {
     return 0;
 }
 
+//! Return the batch kernels encapsulated in class T for the dynamic i converted to a static d. (partial application of
+// template using c)
+template <char c, template <char c1, int d> class T>
+static Interpreter::BatchOp getTemplatizedBatchOp2(int i) {
+    switch (i) {
+        case 1:
+            return getBatchOp<T<c, 1> >();
+        case 2:
+            return getBatchOp<T<c, 2> >();
+        case 3:
+            return getBatchOp<T<c, 3> >();
+        case 4:
+            return getBatchOp<T<c, 4> >();
+        case 5:
+            return getBatchOp<T<c, 5> >();
+        case 6:
+            return getBatchOp<T<c, 6> >();
+        case 7:
+            return getBatchOp<T<c, 7> >();
+        case 8:
+            return getBatchOp<T<c, 8> >();
+        case 9:
+            return getBatchOp<T<c, 9> >();
+        case 10:
+            return getBatchOp<T<c, 10> >();
+        case 11:
+            return getBatchOp<T<c, 11> >();
+        case 12:
+            return getBatchOp<T<c, 12> >();
+        case 13:
+            return getBatchOp<T<c, 13> >();
+        case 14:
+            return getBatchOp<T<c, 14> >();
+        case 15:
+            return getBatchOp<T<c, 15> >();
+        case 16:
+            return getBatchOp<T<c, 16> >();
+        default:
+            assert(false && "Invalid dynamic parameter (not supported template)");
+            break;
+    }
+    return Interpreter::BatchOp();
+}
+
 namespace {
 
-//! Binary operator for strings. Currently only handle '+'
+//! Binary operator for strings. Currently only handle '+', the result is allocated from the frame's string arena
 struct BinaryStringOp {
     static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
-        // get the operand data
-        char*& out = *(char**)c[opData[0]];
-        char* in1 = c[opData[1]];
-        char* in2 = c[opData[2]];
-
-        // delete previous data and allocate a new buffer, only if needed
-        // NOTE: this is more efficient, but might consume more memory...
-        // Maybe make this behaviour configurable ?
-        size_t len1 = strlen(in1);
-        size_t len2 = strlen(in2);
-        if (out == 0 || len1 + len2 + 1 > strlen(out))
-        {
-            delete [] out;
-            out = new char [len1 + len2 + 1];
-        }
-
-        // clear previous evaluation content
-        memset(out, 0, len1 + len2 + 1);
-
-        // concatenate strings
-        strcat(out, in1);
-        strcat(out + len1, in2);
-        out[len1 + len2] = '\0';
-
-        // copy to the output
-        c[opData[3]] = out;
-
+        StringArena* strings = reinterpret_cast<StringArena*>(c[Interpreter::stringArenaSlot]);
+        c[opData[2]] = strings->concat(c[opData[0]], c[opData[1]]);
         return 1;
     }
 };
@@ -188,63 +469,63 @@ struct BinaryStringOp {
 //! Computes a binary op of vector dimension d
 template <char op, int d>
 struct BinaryOp {
-    static double niceMod(double a, double b) {
+    template <class T>
+    static T niceMod(T a, T b) {
         if (b == 0) return 0;
-        return a - floor(a / b) * b;
+        return a - std::floor(a / b) * b;
+    }
+
+    template <class T>
+    static T apply(T a, T b) {
+        switch (op) {
+            case '+':
+                return a + b;
+            case '-':
+                return a - b;
+            case '*':
+                return a * b;
+            case '/':
+                return a / b;
+            case '%':
+                return niceMod(a, b);
+            case '^':
+                return std::pow(a, b);
+            // these only make sense with d==1
+            case '<':
+                return a < b;
+            case '>':
+                return a > b;
+            case 'l':
+                return a <= b;
+            case 'g':
+                return a >= b;
+            case '&':
+                return a && b;
+            case '|':
+                return a || b;
+            default:
+                assert(false);
+        }
+        return 0;
     }
 
     static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
         double* in1 = fp + opData[0];
         double* in2 = fp + opData[1];
         double* out = fp + opData[2];
+        for (int k = 0; k < d; k++) out[k] = apply(in1[k], in2[k]);
+        return 1;
+    }
 
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
         for (int k = 0; k < d; k++) {
-            switch (op) {
-                case '+':
-                    *out = (*in1) + (*in2);
-                    break;
-                case '-':
-                    *out = (*in1) - (*in2);
-                    break;
-                case '*':
-                    *out = (*in1) * (*in2);
-                    break;
-                case '/':
-                    *out = (*in1) / (*in2);
-                    break;
-                case '%':
-                    *out = niceMod(*in1, *in2);
-                    break;
-                case '^':
-                    *out = pow(*in1, *in2);
-                    break;
-                // these only make sense with d==1
-                case '<':
-                    *out = (*in1) < (*in2);
-                    break;
-                case '>':
-                    *out = (*in1) > (*in2);
-                    break;
-                case 'l':
-                    *out = (*in1) <= (*in2);
-                    break;
-                case 'g':
-                    *out = (*in1) >= (*in2);
-                    break;
-                case '&':
-                    *out = (*in1) && (*in2);
-                    break;
-                case '|':
-                    *out = (*in1) || (*in2);
-                    break;
-                default:
-                    assert(false);
-            }
-            in1++;
-            in2++;
-            out++;
+            const T* in1 = fp + (opData[0] + k) * W;
+            const T* in2 = fp + (opData[1] + k) * W;
+            T* out = fp + (opData[2] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) { out[l] = apply(in1[l], in2[l]); });
         }
-        return 1;
     }
 };
 
@@ -273,6 +554,28 @@ struct UnaryOp {
         }
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        for (int k = 0; k < d; k++) {
+            const T* in = fp + (opData[0] + k) * W;
+            T* out = fp + (opData[1] + k) * W;
+            switch (op) {
+                case '-':
+                    forEachLane(lanes, numLanes, [&](int l) { out[l] = -in[l]; });
+                    break;
+                case '~':
+                    forEachLane(lanes, numLanes, [&](int l) { out[l] = 1 - in[l]; });
+                    break;
+                case '!':
+                    forEachLane(lanes, numLanes, [&](int l) { out[l] = !in[l]; });
+                    break;
+                default:
+                    assert(false);
+            }
+        }
+    }
 };
 
 //! Subscripts
@@ -288,6 +591,18 @@ struct Subscript {
             fp[out] = fp[tuple + subscript];
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        const T* tuple = fp + opData[0] * W;
+        const T* subscript = fp + opData[1] * W;
+        T* out = fp + opData[2] * W;
+        forEachLane(lanes, numLanes, [&](int l) {
+            int k = int(subscript[l]);
+            out[l] = (k >= d || k < 0) ? 0 : tuple[k * W + l];
+        });
+    }
 };
 
 //! build a vector tuple from a bunch of numbers
@@ -300,6 +615,16 @@ struct Tuple {
         }
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        for (int k = 0; k < d; k++) {
+            const T* in = fp + opData[k] * W;
+            T* out = fp + (opData[d] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) { out[l] = in[l]; });
+        }
+    }
 };
 
 //! Assign a floating point to another (NOTE: if src and dest have different dimensions, use Promote)
@@ -313,6 +638,16 @@ struct AssignOp {
         }
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        for (int k = 0; k < d; k++) {
+            const T* in = fp + (opData[0] + k) * W;
+            T* out = fp + (opData[1] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) { out[l] = in[l]; });
+        }
+    }
 };
 
 //! Assigns a string from one position to another
@@ -323,6 +658,14 @@ struct AssignStrOp {
         c[out] = c[in];
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        char** in = c + opData[0] * W;
+        char** out = c + opData[1] * W;
+        forEachLane(lanes, numLanes, [&](int l) { out[l] = in[l]; });
+    }
 };
 
 //! Jumps relative to current executing pc if cond is true
@@ -363,6 +706,30 @@ struct EvalVar {
         }
         return 1;
     }
+
+    //! FP variables fetch the values of the active lanes with one evalBatch call. Returns false if the variable has
+    //! no batch fetch, the lanes are then evaluated one at a time.
+    template <class T>
+    static bool batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        ExprVarRef* ref = reinterpret_cast<ExprVarRef*>(c[opData[0] * W]);
+        if (!ref->type().isFP()) return false;
+        int active[W], indices[W], n = 0;
+        forEachLane(lanes, numLanes, [&](int l) {
+            active[n] = l;
+            indices[n++] = static_cast<int>(reinterpret_cast<size_t>(c[W + l]));
+        });
+        int dim = ref->type().dim();
+        double buffer[W * 16];
+        std::vector<double> wideBuffer(dim > 16 ? W * dim : 0);
+        double* values = dim > 16 ? wideBuffer.data() : buffer;
+        if (!ref->evalBatch(values, indices, n)) return false;
+        for (int k = 0; k < dim; k++) {
+            T* dest = fp + (opData[1] + k) * W;
+            for (int i = 0; i < n; i++) dest[active[i]] = static_cast<T>(values[i * dim + k]);
+        }
+        return true;
+    }
 };
 
 //! Evaluates an external variable using a variable block
@@ -378,19 +745,19 @@ struct EvalVarBlock {
     }
 };
 
-//! Evaluates an external variable using a variable block
-template <char uniform, int dim>
-struct EvalVarBlockIndirect {
+//! Evaluates an external variable using a variable block holding data of type S
+template <char uniform, int dim, class S>
+struct EvalVarBlockIndirectAs {
     static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
         if (c[0]) {
             int stride = opData[2];
             int outputVarBlockOffset = opData[0];
             int destIndex = opData[1];
             size_t indirectIndex = reinterpret_cast<size_t>(c[1]);
-            double* basePointer =
-                reinterpret_cast<double**>(c[0])[outputVarBlockOffset] + (uniform ? 0 : (stride * indirectIndex));
+            const S* basePointer =
+                reinterpret_cast<S**>(c[0])[outputVarBlockOffset] + (uniform ? 0 : (stride * indirectIndex));
             double* destPointer = fp + destIndex;
-            for (int i = 0; i < dim; i++) destPointer[i] = basePointer[i];
+            for (int i = 0; i < dim; i++) destPointer[i] = channelValue(basePointer[i]);
         } else {
             // TODO: this happens in initial evaluation!
             // std::cerr<<"Did not get data block"<<std::endl;
@@ -398,7 +765,54 @@ struct EvalVarBlockIndirect {
         }
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        if (!c[0]) return;
+        int stride = opData[2];
+        const S* basePointer = reinterpret_cast<S**>(c[0])[opData[0]];
+        char** indirectIndex = c + W;
+        for (int i = 0; i < dim; i++) {
+            T* destPointer = fp + (opData[1] + i) * W;
+            forEachLane(lanes, numLanes, [&](int l) {
+                size_t index = uniform ? 0 : stride * reinterpret_cast<size_t>(indirectIndex[l]);
+                destPointer[l] = static_cast<T>(channelValue(basePointer[index + i]));
+            });
+        }
+    }
 };
+template <char uniform, int dim>
+using EvalVarBlockIndirect = EvalVarBlockIndirectAs<uniform, dim, double>;
+template <char uniform, int dim>
+using EvalVarBlockIndirectFloat = EvalVarBlockIndirectAs<uniform, dim, float>;
+//! Evaluates an external string variable using a variable block holding a const char* per point
+template <char uniform>
+struct EvalVarBlockIndirectStr {
+    static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
+        if (c[0]) {
+            size_t indirectIndex = reinterpret_cast<size_t>(c[1]);
+            c[opData[1]] = reinterpret_cast<char***>(c[0])[opData[0]][uniform ? 0 : indirectIndex];
+        }
+        return 1;
+    }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        if (!c[0]) return;
+        char** basePointer = reinterpret_cast<char***>(c[0])[opData[0]];
+        char** indirectIndex = c + W;
+        char** dest = c + opData[1] * W;
+        forEachLane(lanes, numLanes, [&](int l) {
+            dest[l] = basePointer[uniform ? 0 : reinterpret_cast<size_t>(indirectIndex[l])];
+        });
+    }
+};
+template <char uniform, int dim>
+using EvalVarBlockIndirectHalf = EvalVarBlockIndirectAs<uniform, dim, Half>;
+template <char uniform, int dim>
+using EvalVarBlockIndirectUInt8 = EvalVarBlockIndirectAs<uniform, dim, uint8_t>;
 
 template <char op, int d>
 struct CompareEqOp {
@@ -424,6 +838,17 @@ struct CompareEqOp {
         *out = result;
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        T* out = fp + opData[2] * W;
+        forEachLane(lanes, numLanes, [&](int l) {
+            bool eq = true;
+            for (int k = 0; k < d; k++) eq &= fp[(opData[0] + k) * W + l] == fp[(opData[1] + k) * W + l];
+            out[l] = op == '=' ? eq : !eq;
+        });
+    }
 };
 
 template <char op>
@@ -435,103 +860,1153 @@ struct CompareEqOp<op, 3> {
         if (op == '!') fp[opData[2]] = !eq;
         return 1;
     }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        const T* a = fp + opData[0] * W;
+        const T* b = fp + opData[1] * W;
+        T* out = fp + opData[2] * W;
+        forEachLane(lanes, numLanes, [&](int l) {
+            bool eq = a[l] == b[l] && a[W + l] == b[W + l] && a[2 * W + l] == b[2 * W + l];
+            out[l] = op == '=' ? eq : !eq;
+        });
+    }
 };
 
+//! Compares strings (interned strings such as literals are equal if their pointers are)
 template <char op, int d>
 struct StrCompareEqOp {
-    // TODO: this should rely on tokenization and not use strcmp
+    static bool equal(const char* a, const char* b) { return a == b || strcmp(a, b) == 0; }
+
     static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
         switch (op) {
             case '=':
-                fp[opData[2]] = strcmp(c[opData[0]], c[opData[1]]) == 0;
+                fp[opData[2]] = equal(c[opData[0]], c[opData[1]]);
                 break;
             case '!':
-                fp[opData[2]] = strcmp(c[opData[0]], c[opData[1]]) != 0;
+                fp[opData[2]] = !equal(c[opData[0]], c[opData[1]]);
                 break;
         }
         return 1;
     }
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        char** a = c + opData[0] * W;
+        char** b = c + opData[1] * W;
+        T* out = fp + opData[2] * W;
+        forEachLane(lanes, numLanes, [&](int l) { out[l] = equal(a[l], b[l]) == (op == '='); });
+    }
+};
+}
+
+namespace {
+
+//! Superinstruction: binary op whose first operand is a scalar broadcast to FP[d] (Promote + BinaryOp)
+template <char op, int d>
+struct BinaryOpScalarLeft {
+    static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
+        double in1 = fp[opData[0]];
+        double* in2 = fp + opData[1];
+        double* out = fp + opData[2];
+        for (int k = 0; k < d; k++) out[k] = BinaryOp<op, d>::apply(in1, in2[k]);
+        return 1;
+    }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        const T* in1 = fp + opData[0] * W;
+        for (int k = 0; k < d; k++) {
+            const T* in2 = fp + (opData[1] + k) * W;
+            T* out = fp + (opData[2] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) { out[l] = BinaryOp<op, d>::apply(in1[l], in2[l]); });
+        }
+    }
+};
+
+//! Superinstruction: binary op whose second operand is a scalar broadcast to FP[d] (Promote + BinaryOp)
+template <char op, int d>
+struct BinaryOpScalarRight {
+    static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
+        double* in1 = fp + opData[0];
+        double in2 = fp[opData[1]];
+        double* out = fp + opData[2];
+        for (int k = 0; k < d; k++) out[k] = BinaryOp<op, d>::apply(in1[k], in2);
+        return 1;
+    }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        const T* in2 = fp + opData[1] * W;
+        for (int k = 0; k < d; k++) {
+            const T* in1 = fp + (opData[0] + k) * W;
+            T* out = fp + (opData[2] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) { out[l] = BinaryOp<op, d>::apply(in1[l], in2[l]); });
+        }
+    }
+};
+
+//! Superinstruction: a*b+c on FP[d] (BinaryOp '*' + BinaryOp '+')
+template <int d>
+struct MulAddOp {
+    static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
+        double* a = fp + opData[0];
+        double* b = fp + opData[1];
+        double* add = fp + opData[2];
+        double* out = fp + opData[3];
+        for (int k = 0; k < d; k++) {
+            double product = a[k] * b[k];
+            out[k] = product + add[k];
+        }
+        return 1;
+    }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        for (int k = 0; k < d; k++) {
+            const T* a = fp + (opData[0] + k) * W;
+            const T* b = fp + (opData[1] + k) * W;
+            const T* add = fp + (opData[2] + k) * W;
+            T* out = fp + (opData[3] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) {
+                T product = a[l] * b[l];
+                out[l] = product + add[l];
+            });
+        }
+    }
+};
+
+//! Superinstruction: s*b+c with a scalar s and FP[d] b and c (Promote + BinaryOp '*' + BinaryOp '+')
+template <int d>
+struct ScalarMulAddOp {
+    static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
+        double a = fp[opData[0]];
+        double* b = fp + opData[1];
+        double* add = fp + opData[2];
+        double* out = fp + opData[3];
+        for (int k = 0; k < d; k++) {
+            double product = a * b[k];
+            out[k] = product + add[k];
+        }
+        return 1;
+    }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        const T* a = fp + opData[0] * W;
+        for (int k = 0; k < d; k++) {
+            const T* b = fp + (opData[1] + k) * W;
+            const T* add = fp + (opData[2] + k) * W;
+            T* out = fp + (opData[3] + k) * W;
+            forEachLane(lanes, numLanes, [&](int l) {
+                T product = a[l] * b[l];
+                out[l] = product + add[l];
+            });
+        }
+    }
+};
+
+//! Superinstruction: loads a scalar from a variable block and broadcasts it to FP[d] (EvalVarBlockIndirect + Promote)
+template <char uniform, int d, class S>
+struct EvalVarBlockIndirectPromoteAs {
+    static int f(int* opData, double* fp, char** c, std::vector<int>& callStack) {
+        if (c[0]) {
+            size_t indirectIndex = reinterpret_cast<size_t>(c[1]);
+            double value = reinterpret_cast<S**>(c[0])[opData[0]][uniform ? 0 : opData[2] * indirectIndex];
+            for (int k = 0; k < d; k++) fp[opData[1] + k] = value;
+        }
+        return 1;
+    }
+
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        const int W = Interpreter::batchSize;
+        if (!c[0]) return;
+        int stride = opData[2];
+        const S* basePointer = reinterpret_cast<S**>(c[0])[opData[0]];
+        char** indirectIndex = c + W;
+        T* dest = fp + opData[1] * W;
+        forEachLane(lanes, numLanes, [&](int l) {
+            dest[l] = basePointer[uniform ? 0 : stride * reinterpret_cast<size_t>(indirectIndex[l])];
+        });
+        for (int k = 1; k < d; k++) {
+            T* out = dest + k * W;
+            forEachLane(lanes, numLanes, [&](int l) { out[l] = dest[l]; });
+        }
+    }
 };
+template <char uniform, int d>
+using EvalVarBlockIndirectPromote = EvalVarBlockIndirectPromoteAs<uniform, d, double>;
+template <char uniform, int d>
+using EvalVarBlockIndirectPromoteFloat = EvalVarBlockIndirectPromoteAs<uniform, d, float>;
 }
 
 namespace {
 int ProcedureReturn(int* opData, double* fp, char** c, std::vector<int>& callStack) {
-    int newPC = callStack.back();
-    callStack.pop_back();
+    int newPC = callStack[callStack[0]--];
     return newPC - opData[0];
 }
 }
 
 namespace {
 int ProcedureCall(int* opData, double* fp, char** c, std::vector<int>& callStack) {
-    callStack.push_back(opData[0]);
+    callStack[++callStack[0]] = opData[0];
     return opData[1];
 }
 }
 
+template <class T>
+void Interpreter::evalBatch(int pcBegin, int pcEnd, BatchFrame<T>& frame, const int* lanes, int numLanes) const {
+    const int W = batchSize;
+    T* fp = frame.fp.data();
+    char** str = frame.str.data();
+    int pc = pcBegin;
+    while (pc < pcEnd) {
+        OpF op = ops[pc].first;
+        int* opCurr = const_cast<int*>(opData.data()) + ops[pc].second;
+        if (op == JmpRelative::f) {
+            pc += opCurr[0];
+        } else if (op == CondJmpRelativeIfFalse::f || op == CondJmpRelativeIfTrue::f) {
+            // split the lanes on the condition; the jump target is preceded by a jump to the join point
+            bool jumpIf = op == CondJmpRelativeIfTrue::f;
+            const T* cond = fp + opCurr[0] * W;
+            int fallLanes[W], jumpLanes[W];
+            int numFall = 0, numJump = 0;
+            forEachLane(lanes, numLanes, [&](int l) {
+                if (bool(cond[l]) == jumpIf)
+                    jumpLanes[numJump++] = l;
+                else
+                    fallLanes[numFall++] = l;
+            });
+            int target = pc + opCurr[1];
+            if (numJump == 0) {
+                pc++;
+            } else if (numFall == 0) {
+                pc = target;
+            } else {
+                int join = target - 1 + opData[ops[target - 1].second];
+                evalBatch(pc + 1, target - 1, frame, fallLanes, numFall);
+                evalBatch(target, join, frame, jumpLanes, numJump);
+                pc = join;
+            }
+        } else if (op == ProcedureCall) {
+            // every active lane runs the body, up to its return, and continues after the call
+            int body = pc + opCurr[1], ret = body;
+            while (ops[ret].first != ProcedureReturn) ret++;
+            evalBatch(body, ret, frame, lanes, numLanes);
+            pc = opCurr[0];
+        } else if (op == EvalVar::f) {
+            if (!EvalVar::batch(opCurr, fp, str, lanes, numLanes))
+                forEachLane(lanes, numLanes, [&](int l) { evalLane(pc, frame, l); });
+            pc++;
+        } else {
+            if (auto batchOp = batchOps[pc].kernel(fp))
+                batchOp(opCurr, fp, str, lanes, numLanes);
+            else
+                forEachLane(lanes, numLanes, [&](int l) { evalLane(pc, frame, l); });
+            pc++;
+        }
+    }
+}
+
+template <class T>
+void Interpreter::evalLane(int pc, BatchFrame<T>& frame, int lane) const {
+    const int W = batchSize;
+    int begin = ops[pc].second;
+    int end = opDataEnd(pc);
+    for (int k = begin; k < end; k++) {
+        int slot = opData[k];
+        const OperandInfo& info = operandInfo[k];
+        if (info.kind == okFPIN)
+            for (int i = 0; i < info.dim; i++) frame.laneFp[slot + i] = frame.fp[(slot + i) * W + lane];
+        else if (info.kind == okPTRIN)
+            frame.laneStr[slot] = frame.str[slot * W + lane];
+    }
+    frame.laneStr[1] = frame.str[W + lane];
+    if (frame.block) frame.block->indirectIndex = static_cast<int>(reinterpret_cast<size_t>(frame.laneStr[1]));
+    int* opCurr = const_cast<int*>(opData.data()) + begin;
+    ops[pc].first(opCurr, frame.laneFp.data(), frame.laneStr.data(), frame.callStack);
+    for (int k = begin; k < end; k++) {
+        int slot = opData[k];
+        const OperandInfo& info = operandInfo[k];
+        if (info.kind == okFPOUT)
+            for (int i = 0; i < info.dim; i++) frame.fp[(slot + i) * W + lane] = static_cast<T>(frame.laneFp[slot + i]);
+        else if (info.kind == okPTROUT)
+            frame.str[slot * W + lane] = frame.laneStr[slot];
+    }
+}
+
+struct Interpreter::OpRecord {
+    OpF op;
+    BatchOp batchOp;
+    std::vector<int> operands;
+    std::vector<OperandInfo> info;
+    bool removed;
+
+    void set(OpF newOp, BatchOp newBatchOp) {
+        op = newOp;
+        batchOp = newBatchOp;
+        operands.clear();
+        info.clear();
+    }
+    void add(int operand, OperandKind kind, int dim = 1) {
+        operands.push_back(operand);
+        info.push_back({kind, dim});
+    }
+    //! Finds the only fp output of the op
+    bool output(int& slot, int& dim) const {
+        int found = 0;
+        for (size_t k = 0; k < operands.size(); k++)
+            if (info[k].kind == okFPOUT) {
+                slot = operands[k];
+                dim = info[k].dim;
+                found++;
+            } else if (info[k].kind == okPTROUT) {
+                return false;
+            }
+        return found == 1;
+    }
+    //! Whether the op is control flow (it has jump or pc operands)
+    bool control() const {
+        for (size_t k = 0; k < operands.size(); k++)
+            if (info[k].kind == okJUMP || info[k].kind == okPC) return true;
+        return false;
+    }
+    //! Whether the op reads any of the fp slots [slot,slot+dim)
+    bool reads(int slot, int dim) const {
+        for (size_t k = 0; k < operands.size(); k++)
+            if (info[k].kind == okFPIN && operands[k] < slot + dim && slot < operands[k] + info[k].dim) return true;
+        return false;
+    }
+};
+
+std::vector<Interpreter::OpRecord> Interpreter::unpackOps() const {
+    std::vector<OpRecord> records(ops.size());
+    for (int pc = 0; pc < static_cast<int>(ops.size()); pc++) {
+        OpRecord& record = records[pc];
+        record.op = ops[pc].first;
+        record.batchOp = batchOps[pc];
+        record.operands.assign(opData.begin() + ops[pc].second, opData.begin() + opDataEnd(pc));
+        record.info.assign(operandInfo.begin() + ops[pc].second, operandInfo.begin() + opDataEnd(pc));
+        record.removed = false;
+    }
+    return records;
+}
+
+void Interpreter::packOps(const std::vector<OpRecord>& records) {
+    // removed ops fall through to the next remaining op, so jumps are retargeted there
+    int numOps = static_cast<int>(records.size());
+    std::vector<int> newPC(numOps + 1);
+    for (int pc = 0, next = 0; pc <= numOps; pc++) {
+        newPC[pc] = next;
+        if (pc < numOps && !records[pc].removed) next++;
+    }
+
+    ops.clear();
+    batchOps.clear();
+    opData.clear();
+    operandInfo.clear();
+    for (int pc = 0; pc < numOps; pc++) {
+        const OpRecord& record = records[pc];
+        if (record.removed) continue;
+        ops.push_back(std::make_pair(record.op, static_cast<int>(opData.size())));
+        batchOps.push_back(record.batchOp);
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            int operand = record.operands[k];
+            if (record.info[k].kind == okJUMP)
+                operand = newPC[pc + operand] - newPC[pc];
+            else if (record.info[k].kind == okPC)
+                operand = newPC[operand];
+            opData.push_back(operand);
+            operandInfo.push_back(record.info[k]);
+        }
+    }
+    _pcStart = newPC[_pcStart];
+    _varyingStart = newPC[_varyingStart];
+}
+
+bool Interpreter::describedOps() const {
+    for (size_t k = 0; k < operandInfo.size(); k++)
+        if (operandInfo[k].kind == okUNKNOWN) return false;
+    return true;
+}
+
+bool Interpreter::pointDependent(OpF op) {
+    if (op == EvalVar::f || op == ExprFuncSimple::EvalOp || op == ProcedureCall || op == ProcedureReturn ||
+        op == EvalVarBlockIndirectStr<0>::f)
+        return true;
+    for (int d = 1; d <= 16; d++)
+        if (op == getTemplatizedOp2<0, EvalVarBlockIndirect>(d) ||
+            op == getTemplatizedOp2<0, EvalVarBlockIndirectPromote>(d) || op == getTemplatizedOp<EvalVarBlock>(d) ||
+            op == getTemplatizedOp2<0, EvalVarBlockIndirectFloat>(d) ||
+            op == getTemplatizedOp2<0, EvalVarBlockIndirectPromoteFloat>(d) ||
+            op == getTemplatizedOp2<0, EvalVarBlockIndirectHalf>(d) ||
+            op == getTemplatizedOp2<0, EvalVarBlockIndirectUInt8>(d))
+            return true;
+    return false;
+}
+
+bool Interpreter::uniformLoad(OpF op) {
+    if (op == EvalVarBlockIndirectStr<1>::f) return true;
+    for (int d = 1; d <= 16; d++)
+        if (op == getTemplatizedOp2<1, EvalVarBlockIndirect>(d) ||
+            op == getTemplatizedOp2<1, EvalVarBlockIndirectPromote>(d) ||
+            op == getTemplatizedOp2<1, EvalVarBlockIndirectFloat>(d) ||
+            op == getTemplatizedOp2<1, EvalVarBlockIndirectPromoteFloat>(d) ||
+            op == getTemplatizedOp2<1, EvalVarBlockIndirectHalf>(d) ||
+            op == getTemplatizedOp2<1, EvalVarBlockIndirectUInt8>(d))
+            return true;
+    return false;
+}
+
+bool Interpreter::evalConstantProgram(std::vector<OpRecord>& records) {
+    // a constant program without implicit inputs computes the same result every time, so it is run once now
+    int numOps = static_cast<int>(records.size());
+    if (_pcStart != 0) return false;
+    for (const OpRecord& record : records)
+        if (pointDependent(record.op) || uniformLoad(record.op)) return false;
+    for (int pc = 0; pc < numOps;) pc += records[pc].op(records[pc].operands.data(), d.data(), s.data(), callStack);
+    for (OpRecord& record : records) record.removed = true;
+    return true;
+}
+
+void Interpreter::foldConstantOps(std::vector<OpRecord>& records) {
+    // Slots never written at runtime hold constants. An op computing only from constants into slots nothing else
+    // writes is run once here and removed, its outputs become constants in turn.
+    int numOps = static_cast<int>(records.size());
+    std::vector<int> fpWrites(d.size()), ptrWrites(s.size());
+    for (const OpRecord& record : records)
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            if (record.info[k].kind == okFPOUT)
+                for (int i = 0; i < record.info[k].dim; i++) fpWrites[record.operands[k] + i]++;
+            else if (record.info[k].kind == okPTROUT)
+                ptrWrites[record.operands[k]]++;
+        }
+    ptrWrites[0] = ptrWrites[1] = 1;  // variable block pointers
+
+    for (int pc = 0; pc < numOps; pc++) {
+        OpRecord& record = records[pc];
+        if (record.removed || pointDependent(record.op) || uniformLoad(record.op) || record.control()) continue;
+        bool constant = true;
+        for (size_t k = 0; k < record.operands.size() && constant; k++) {
+            int operand = record.operands[k], dim = record.info[k].dim;
+            switch (record.info[k].kind) {
+                case okFPIN:
+                    for (int i = 0; i < dim; i++) constant = constant && fpWrites[operand + i] == 0;
+                    break;
+                case okFPOUT:
+                    for (int i = 0; i < dim; i++) constant = constant && fpWrites[operand + i] == 1;
+                    break;
+                case okPTRIN:
+                    constant = ptrWrites[operand] == 0;
+                    break;
+                case okPTROUT:
+                    constant = ptrWrites[operand] == 1;
+                    break;
+                default:
+                    break;
+            }
+        }
+        if (!constant) continue;
+        record.op(record.operands.data(), d.data(), s.data(), callStack);
+        record.removed = true;
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            if (record.info[k].kind == okFPOUT)
+                for (int i = 0; i < record.info[k].dim; i++) fpWrites[record.operands[k] + i] = 0;
+            else if (record.info[k].kind == okPTROUT)
+                ptrWrites[record.operands[k]] = 0;
+        }
+    }
+}
+
+void Interpreter::eliminateCommonOps(std::vector<OpRecord>& records, std::vector<Output>& outputs) const {
+    // An op outside any branch computes the same values as an earlier one outside any branch if they are the same op
+    // on the same immediates and inputs, where an input is the same if it is the same constant or the same slot with no
+    // write in between. The later op is removed and its results are read from the earlier op's outputs instead. Only
+    // ops whose outputs are written by no other op and only read whole are considered.
+    int numOps = static_cast<int>(records.size());
+    std::vector<bool> branch(numOps);
+    std::vector<int> fpWrites(d.size()), ptrWrites(s.size()), fpWriter(d.size(), -1), ptrWriter(s.size(), -1);
+    // the smallest start and largest end of the fp ranges read through each slot
+    std::vector<int> readStart(d.size(), std::numeric_limits<int>::max()), readEnd(d.size(), -1);
+    for (int pc = 0; pc < numOps; pc++) {
+        const OpRecord& record = records[pc];
+        if (record.op == ProcedureCall) return;  // procedure bodies run out of program order
+        if (record.removed) continue;
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            int operand = record.operands[k], dim = record.info[k].dim;
+            switch (record.info[k].kind) {
+                case okJUMP:
+                    for (int i = std::min(pc, pc + operand); i < std::max(pc, pc + operand); i++) branch[i] = true;
+                    break;
+                case okFPIN:
+                    for (int i = 0; i < dim; i++) {
+                        readStart[operand + i] = std::min(readStart[operand + i], operand);
+                        readEnd[operand + i] = std::max(readEnd[operand + i], operand + dim);
+                    }
+                    break;
+                case okFPOUT:
+                    for (int i = 0; i < dim; i++) {
+                        fpWrites[operand + i]++;
+                        fpWriter[operand + i] = pc;
+                    }
+                    break;
+                case okPTROUT:
+                    ptrWrites[operand]++;
+                    ptrWriter[operand] = pc;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    for (const Output& output : outputs)
+        if (output.kind == okFPIN)
+            for (int i = 0; i < output.dim; i++) {
+                readStart[output.slot + i] = std::min(readStart[output.slot + i], output.slot);
+                readEnd[output.slot + i] = std::max(readEnd[output.slot + i], output.slot + output.dim);
+            }
+
+    // slots the results of removed ops are read from instead
+    std::vector<int> fpMap(d.size()), ptrMap(s.size());
+    for (size_t k = 0; k < fpMap.size(); k++) fpMap[k] = static_cast<int>(k);
+    for (size_t k = 0; k < ptrMap.size(); k++) ptrMap[k] = static_cast<int>(k);
+    std::map<std::vector<int64_t>, int> computed;
+    for (int pc = _pcStart; pc < numOps; pc++) {
+        OpRecord& record = records[pc];
+        if (record.removed) continue;
+        for (size_t k = 0; k < record.operands.size(); k++)
+            if (record.info[k].kind == okFPIN)
+                record.operands[k] = fpMap[record.operands[k]];
+            else if (record.info[k].kind == okPTRIN)
+                record.operands[k] = ptrMap[record.operands[k]];
+        // variable loads give the same value for the whole point, other ops without side effects depend only on
+        // their operands
+        bool sideEffects = record.op == EvalVar::f || record.op == ExprFuncSimple::EvalOp ||
+                           record.op == ProcedureReturn || record.control();
+        if (branch[pc] || sideEffects) continue;
+
+        // the key of the computation, every input slot must hold the same value wherever the key is looked up
+        std::vector<int64_t> key(1, static_cast<int64_t>(reinterpret_cast<intptr_t>(record.op)));
+        bool common = true, writes = false;
+        for (size_t k = 0; k < record.operands.size() && common; k++) {
+            int operand = record.operands[k], dim = record.info[k].dim;
+            OperandKind kind = record.info[k].kind;
+            key.push_back(kind);
+            key.push_back(dim);
+            switch (kind) {
+                case okIMMEDIATE:
+                    key.push_back(operand);
+                    break;
+                case okFPIN:
+                    for (int i = 0; i < dim && common; i++) {
+                        int slot = operand + i;
+                        if (fpWrites[slot] == 0) {
+                            int64_t bits;
+                            memcpy(&bits, &d[slot], sizeof(bits));
+                            key.push_back(0);
+                            key.push_back(bits);
+                        } else {
+                            common = fpWrites[slot] == 1 && fpWriter[slot] < pc && !branch[fpWriter[slot]];
+                            key.push_back(1);
+                            key.push_back(slot);
+                        }
+                    }
+                    break;
+                case okPTRIN:
+                    if (ptrWrites[operand] == 0 && operand >= reservedPtrSlots) {
+                        key.push_back(0);
+                        key.push_back(static_cast<int64_t>(reinterpret_cast<intptr_t>(s[operand])));
+                    } else {
+                        common = ptrWrites[operand] == 0 ||
+                                 (ptrWrites[operand] == 1 && ptrWriter[operand] < pc && !branch[ptrWriter[operand]]);
+                        key.push_back(1);
+                        key.push_back(operand);
+                    }
+                    break;
+                case okFPOUT:
+                    writes = true;
+                    for (int i = 0; i < dim && common; i++)
+                        common = fpWrites[operand + i] == 1 && readStart[operand + i] >= operand &&
+                                 readEnd[operand + i] <= operand + dim;
+                    common = common && !record.reads(operand, dim);
+                    break;
+                case okPTROUT:
+                    writes = true;
+                    common = ptrWrites[operand] == 1;
+                    break;
+                default:
+                    common = false;
+                    break;
+            }
+        }
+        if (!common || !writes) continue;
+
+        std::pair<std::map<std::vector<int64_t>, int>::iterator, bool> found = computed.insert(std::make_pair(key, pc));
+        if (found.second) continue;
+        const OpRecord& earlier = records[found.first->second];
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            int from = record.operands[k], to = earlier.operands[k];
+            if (record.info[k].kind == okFPOUT)
+                for (int i = 0; i < record.info[k].dim; i++) fpMap[from + i] = to + i;
+            else if (record.info[k].kind == okPTROUT)
+                ptrMap[from] = to;
+        }
+        record.removed = true;
+    }
+    for (Output& output : outputs) output.slot = output.kind == okFPIN ? fpMap[output.slot] : ptrMap[output.slot];
+}
+
+void Interpreter::removeDeadOps(std::vector<OpRecord>& records, const std::vector<Output>& outputs) {
+    // ops without side effects (anything but custom functions and control flow) whose results are never read are
+    // removed, latest first so their inputs may follow
+    int numOps = static_cast<int>(records.size());
+    std::vector<int> fpReads(d.size()), ptrReads(s.size());
+    auto count = [&](const OpRecord& record, int delta) {
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            if (record.info[k].kind == okFPIN)
+                for (int i = 0; i < record.info[k].dim; i++) fpReads[record.operands[k] + i] += delta;
+            else if (record.info[k].kind == okPTRIN)
+                ptrReads[record.operands[k]] += delta;
+        }
+    };
+    for (const OpRecord& record : records)
+        if (!record.removed) count(record, 1);
+    for (const Output& output : outputs) {
+        if (output.kind == okFPIN)
+            for (int i = 0; i < output.dim && output.slot + i < static_cast<int>(d.size()); i++)
+                fpReads[output.slot + i]++;
+        else
+            ptrReads[output.slot]++;
+    }
+
+    for (int pc = numOps - 1; pc >= 0; pc--) {
+        OpRecord& record = records[pc];
+        bool sideEffects = record.op == ExprFuncSimple::EvalOp || record.op == ProcedureCall ||
+                           record.op == ProcedureReturn || record.control();
+        if (record.removed || sideEffects) continue;
+        bool dead = true, outputs = false;
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            int operand = record.operands[k];
+            if (record.info[k].kind == okFPOUT) {
+                outputs = true;
+                for (int i = 0; i < record.info[k].dim; i++) dead = dead && fpReads[operand + i] == 0;
+            } else if (record.info[k].kind == okPTROUT) {
+                outputs = true;
+                dead = dead && ptrReads[operand] == 0;
+            }
+        }
+        if (!dead || !outputs) continue;
+        record.removed = true;
+        count(record, -1);
+    }
+}
+
+void Interpreter::splitUniform(std::vector<OpRecord>& records) {
+    // Ops run for every point unless they are outside any branch, depend only on their operands and only read slots
+    // that no such op writes. Those are moved, in order, to a prologue before the rest of the program. A branch
+    // region keeps its ops together, so its relative jumps still land on the op following it.
+    int numOps = static_cast<int>(records.size());
+    if (_pcStart != 0) return;  // local function bodies come first and run on call
+    std::vector<bool> hoist(numOps, true);
+    std::vector<int> fpWrites(d.size()), ptrWrites(s.size());
+    for (int pc = 0; pc < numOps; pc++) {
+        const OpRecord& record = records[pc];
+        if (pointDependent(record.op)) hoist[pc] = false;
+        if (record.removed) continue;
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            int operand = record.operands[k];
+            switch (record.info[k].kind) {
+                case okJUMP:
+                    for (int i = std::min(pc, pc + operand); i < std::max(pc, pc + operand); i++) hoist[i] = false;
+                    break;
+                case okPC:
+                    return;
+                case okFPOUT:
+                    for (int i = 0; i < record.info[k].dim; i++) fpWrites[operand + i]++;
+                    break;
+                case okPTROUT:
+                    ptrWrites[operand]++;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // a slot written more than once keeps all of its writes in order, a slot written by an op that stays varies
+    std::vector<bool> fpVarying(d.size()), ptrVarying(s.size());
+    ptrVarying[0] = ptrVarying[1] = true;
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int pc = 0; pc < numOps; pc++) {
+            const OpRecord& record = records[pc];
+            if (record.removed) continue;
+            for (size_t k = 0; k < record.operands.size() && hoist[pc]; k++) {
+                int operand = record.operands[k], dim = record.info[k].dim;
+                switch (record.info[k].kind) {
+                    case okFPIN:
+                        for (int i = 0; i < dim; i++) hoist[pc] = hoist[pc] && !fpVarying[operand + i];
+                        break;
+                    case okFPOUT:
+                        for (int i = 0; i < dim; i++) hoist[pc] = hoist[pc] && fpWrites[operand + i] == 1;
+                        break;
+                    case okPTRIN:
+                        hoist[pc] = !ptrVarying[operand];
+                        break;
+                    case okPTROUT:
+                        hoist[pc] = ptrWrites[operand] == 1;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            if (hoist[pc]) continue;
+            for (size_t k = 0; k < record.operands.size(); k++) {
+                int operand = record.operands[k], dim = record.info[k].dim;
+                if (record.info[k].kind == okFPOUT) {
+                    for (int i = 0; i < dim; i++) {
+                        changed = changed || !fpVarying[operand + i];
+                        fpVarying[operand + i] = true;
+                    }
+                } else if (record.info[k].kind == okPTROUT) {
+                    changed = changed || !ptrVarying[operand];
+                    ptrVarying[operand] = true;
+                }
+            }
+        }
+    }
+
+    std::vector<OpRecord> prologue, body;
+    for (int pc = 0; pc < numOps; pc++) (hoist[pc] ? prologue : body).push_back(records[pc]);
+    _varyingStart = static_cast<int>(prologue.size());
+    records.swap(prologue);
+    records.insert(records.end(), body.begin(), body.end());
+}
+
+namespace {
+//! Returns which BinaryOp (or BinaryOpScalarLeft/Right) of dimension d the op is, if any
+template <template <char c1, int d> class T>
+char binaryOpType(Interpreter::OpF op, int d) {
+    if (d < 1 || d > 16) return 0;
+    if (op == getTemplatizedOp2<'+', T>(d)) return '+';
+    if (op == getTemplatizedOp2<'-', T>(d)) return '-';
+    if (op == getTemplatizedOp2<'*', T>(d)) return '*';
+    if (op == getTemplatizedOp2<'/', T>(d)) return '/';
+    if (op == getTemplatizedOp2<'%', T>(d)) return '%';
+    if (op == getTemplatizedOp2<'^', T>(d)) return '^';
+    return 0;
+}
+
+template <template <char c1, int d> class T>
+std::pair<Interpreter::OpF, Interpreter::BatchOp> getBinaryOp(char op, int d) {
+    switch (op) {
+        case '+':
+            return std::make_pair(getTemplatizedOp2<'+', T>(d), getTemplatizedBatchOp2<'+', T>(d));
+        case '-':
+            return std::make_pair(getTemplatizedOp2<'-', T>(d), getTemplatizedBatchOp2<'-', T>(d));
+        case '*':
+            return std::make_pair(getTemplatizedOp2<'*', T>(d), getTemplatizedBatchOp2<'*', T>(d));
+        case '/':
+            return std::make_pair(getTemplatizedOp2<'/', T>(d), getTemplatizedBatchOp2<'/', T>(d));
+        case '%':
+            return std::make_pair(getTemplatizedOp2<'%', T>(d), getTemplatizedBatchOp2<'%', T>(d));
+        default:
+            return std::make_pair(getTemplatizedOp2<'^', T>(d), getTemplatizedBatchOp2<'^', T>(d));
+    }
+}
+}
+
+void Interpreter::fuse(std::vector<OpRecord>& records, const std::vector<Output>& outputs) const {
+    // count the ops reading and writing each fp slot (the caller reads the outputs) and find the jump targets
+    int numOps = static_cast<int>(records.size());
+    std::vector<int> reads(d.size()), writes(d.size());
+    std::vector<bool> jumpTarget(numOps + 1);
+    for (int pc = 0; pc < numOps; pc++) {
+        const OpRecord& record = records[pc];
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            int operand = record.operands[k];
+            switch (record.info[k].kind) {
+                case okFPIN:
+                    for (int i = 0; i < record.info[k].dim; i++) reads[operand + i]++;
+                    break;
+                case okFPOUT:
+                    for (int i = 0; i < record.info[k].dim; i++) writes[operand + i]++;
+                    break;
+                case okJUMP:
+                    jumpTarget[pc + operand] = true;
+                    break;
+                case okPC:
+                    jumpTarget[operand] = true;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    for (const Output& output : outputs)
+        if (output.kind == okFPIN)
+            for (int i = 0; i < output.dim && output.slot + i < static_cast<int>(d.size()); i++)
+                reads[output.slot + i]++;
+    jumpTarget[_varyingStart] = true;  // keep the uniform prologue and the varying body apart
+    // a temporary produced by one op and consumed by exactly one other
+    auto temporary = [&](int slot, int dim) {
+        for (int i = 0; i < dim; i++)
+            if (reads[slot + i] != 1 || writes[slot + i] != 1) return false;
+        return true;
+    };
+
+    // The first sweep folds broadcasts into binary ops and forms multiply-adds, the second folds broadcasts into
+    // variable loads and forwards results into assignments. Fused ops take the place of the later op, so the pair
+    // must not be split by a jump target.
+    for (int sweep = 0; sweep < 2; sweep++) {
+        int prev = -1;
+        for (int pc = 0; pc < numOps; pc++) {
+            OpRecord& b = records[pc];
+            if (b.removed) continue;
+            bool split = prev < 0;
+            for (int k = prev + 1; k <= pc && !split; k++) split = jumpTarget[k];
+            int t = -1, dimA = 0, dimB = 0, outB = -1;
+            if (split || !records[prev].output(t, dimA) || !b.output(outB, dimB) || !temporary(t, dimA) ||
+                !b.reads(t, dimA)) {
+                prev = pc;
+                continue;
+            }
+            OpRecord& a = records[prev];
+            bool fused = false;
+            if (sweep == 0) {
+                char opB = binaryOpType<BinaryOp>(b.op, dimB);
+                if (dimB > 1 && dimA == dimB && opB && a.op == getTemplatizedOp<Promote>(dimA)) {
+                    // Promote + BinaryOp -> binary op with a scalar operand
+                    int scalar = a.operands[0], in1 = b.operands[0], in2 = b.operands[1];
+                    bool left = in1 == t;
+                    std::pair<OpF, BatchOp> op =
+                        left ? getBinaryOp<BinaryOpScalarLeft>(opB, dimB) : getBinaryOp<BinaryOpScalarRight>(opB, dimB);
+                    b.set(op.first, op.second);
+                    b.add(left ? scalar : in1, okFPIN, left ? 1 : dimB);
+                    b.add(left ? in2 : scalar, okFPIN, left ? dimB : 1);
+                    b.add(outB, okFPOUT, dimB);
+                    fused = true;
+                } else if (opB == '+' && dimA == dimB) {
+                    // BinaryOp '*' + BinaryOp '+' -> multiply-add
+                    int add = b.operands[0] == t ? b.operands[1] : b.operands[0];
+                    int in1 = a.operands[0], in2 = a.operands[1];
+                    if (binaryOpType<BinaryOp>(a.op, dimA) == '*') {
+                        b.set(getTemplatizedOp<MulAddOp>(dimB), getTemplatizedBatchOp<MulAddOp>(dimB));
+                        b.add(in1, okFPIN, dimB);
+                        b.add(in2, okFPIN, dimB);
+                        fused = true;
+                    } else if (binaryOpType<BinaryOpScalarLeft>(a.op, dimA) == '*' ||
+                               binaryOpType<BinaryOpScalarRight>(a.op, dimA) == '*') {
+                        bool left = binaryOpType<BinaryOpScalarLeft>(a.op, dimA) == '*';
+                        b.set(getTemplatizedOp<ScalarMulAddOp>(dimB), getTemplatizedBatchOp<ScalarMulAddOp>(dimB));
+                        b.add(left ? in1 : in2, okFPIN);
+                        b.add(left ? in2 : in1, okFPIN, dimB);
+                        fused = true;
+                    }
+                    if (fused) {
+                        b.add(add, okFPIN, dimB);
+                        b.add(outB, okFPOUT, dimB);
+                    }
+                }
+            } else {
+                bool uniformLoad = a.op == EvalVarBlockIndirect<1, 1>::f || a.op == EvalVarBlockIndirectFloat<1, 1>::f;
+                bool floatLoad =
+                    a.op == EvalVarBlockIndirectFloat<0, 1>::f || a.op == EvalVarBlockIndirectFloat<1, 1>::f;
+                bool varyingLoad = a.op == EvalVarBlockIndirect<0, 1>::f || a.op == EvalVarBlockIndirectFloat<0, 1>::f;
+                if (dimA == 1 && dimB > 1 && b.op == getTemplatizedOp<Promote>(dimB) && (uniformLoad || varyingLoad)) {
+                    // EvalVarBlockIndirect + Promote -> load and broadcast
+                    int offset = a.operands[0], stride = a.operands[2];
+                    if (floatLoad && uniformLoad)
+                        b.set(getTemplatizedOp2<1, EvalVarBlockIndirectPromoteFloat>(dimB),
+                              getTemplatizedBatchOp2<1, EvalVarBlockIndirectPromoteFloat>(dimB));
+                    else if (floatLoad)
+                        b.set(getTemplatizedOp2<0, EvalVarBlockIndirectPromoteFloat>(dimB),
+                              getTemplatizedBatchOp2<0, EvalVarBlockIndirectPromoteFloat>(dimB));
+                    else if (uniformLoad)
+                        b.set(getTemplatizedOp2<1, EvalVarBlockIndirectPromote>(dimB),
+                              getTemplatizedBatchOp2<1, EvalVarBlockIndirectPromote>(dimB));
+                    else
+                        b.set(getTemplatizedOp2<0, EvalVarBlockIndirectPromote>(dimB),
+                              getTemplatizedBatchOp2<0, EvalVarBlockIndirectPromote>(dimB));
+                    b.add(offset, okIMMEDIATE);
+                    b.add(outB, okFPOUT, dimB);
+                    b.add(stride, okIMMEDIATE);
+                    fused = true;
+                } else if (dimA == dimB && b.op == getTemplatizedOp<AssignOp>(dimB) && !a.reads(outB, dimB)) {
+                    // op + AssignOp -> op writing straight to the assigned variable (the assign is removed instead)
+                    for (size_t k = 0; k < a.operands.size(); k++)
+                        if (a.info[k].kind == okFPOUT) a.operands[k] = outB;
+                    b.removed = true;
+                    for (int i = 0; i < dimA; i++) reads[t + i] = writes[t + i] = 0;
+                    continue;
+                }
+            }
+            if (fused) {
+                a.removed = true;
+                for (int i = 0; i < dimA; i++) reads[t + i] = writes[t + i] = 0;
+            }
+            prev = pc;
+        }
+    }
+}
+
+bool Interpreter::allocateSlots(std::vector<OpRecord>& records, std::vector<Output>& outputs) {
+    // Every allocation is live from its first access to its last. Ops only jump forward, so any value produced at
+    // one pc and read at a later one stays within that range on every path. Allocations read before they are
+    // written (constants and values computed while building) keep their own slot, as do the outputs.
+    // Procedure bodies (the ops before _pcStart) run out of program order, at each of their calls, so what they
+    // access keeps its own slot too.
+    const int numOps = static_cast<int>(records.size());
+    const int always = numOps + 1;
+    std::vector<int> fpMap, ptrMap;
+    for (int space = 0; space < 2; space++) {
+        bool fp = space == 0;
+        OperandKind inKind = fp ? okFPIN : okPTRIN, outKind = fp ? okFPOUT : okPTROUT;
+        const std::vector<int>& allocs = fp ? _fpAllocs : _ptrAllocs;
+        int numSlots = static_cast<int>(fp ? d.size() : s.size());
+        int numUnits = static_cast<int>(allocs.size());
+        std::vector<int> unitOf(numSlots, -1), size(numUnits);
+        for (int u = 0; u < numUnits; u++) {
+            size[u] = (u + 1 < numUnits ? allocs[u + 1] : numSlots) - allocs[u];
+            for (int k = 0; k < size[u]; k++) unitOf[allocs[u] + k] = u;
+        }
+
+        std::vector<int> first(numUnits, -1), last(numUnits, -1);
+        auto access = [&](int pc, int slot, int dim, bool write) {
+            if (!fp && slot >= 0 && slot + dim <= reservedPtrSlots) return true;  // reserved pointers
+            int u = slot >= 0 && slot < numSlots ? unitOf[slot] : -1;
+            if (u < 0 || slot + dim > allocs[u] + size[u]) return false;
+            if (first[u] < 0) first[u] = write && pc >= _pcStart ? pc : always;
+            if (pc < _pcStart) first[u] = always;
+            if (first[u] != always) last[u] = pc;
+            return true;
+        };
+        for (int pc = 0; pc < numOps; pc++) {
+            const OpRecord& record = records[pc];
+            if (record.removed) continue;
+            for (int pass = 0; pass < 2; pass++) {
+                OperandKind kind = pass == 0 ? inKind : outKind;
+                for (size_t k = 0; k < record.operands.size(); k++)
+                    if (record.info[k].kind == kind &&
+                        !access(pc, record.operands[k], record.info[k].dim, kind == outKind))
+                        return false;
+            }
+        }
+        // evalMultiple repeats the body after a single run of the prologue, so prologue values it reads must survive it
+        for (int u = 0; u < numUnits; u++)
+            if (first[u] >= 0 && first[u] < _varyingStart && last[u] >= _varyingStart) last[u] = numOps;
+        for (const Output& output : outputs) {
+            if (output.kind != inKind) continue;
+            int u = output.slot >= 0 && output.slot < numSlots ? unitOf[output.slot] : -1;
+            if (u < 0 || output.slot + output.dim > allocs[u] + size[u]) return false;
+            first[u] = always;
+        }
+
+        // linear scan in order of first access, reusing slots of allocations whose last access has passed
+        std::vector<int> order;
+        for (int u = 0; u < numUnits; u++)
+            if (first[u] >= 0) order.push_back(u);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            int startA = first[a] == always ? -1 : first[a], startB = first[b] == always ? -1 : first[b];
+            return startA < startB;
+        });
+        std::vector<int> newStart(numUnits, -1), active;
+        std::map<int, std::vector<int>> freeSlots;
+        int top = fp ? 0 : reservedPtrSlots;  // keep the reserved pointers (variable block, string arena) in place
+        for (int u : order) {
+            int start = first[u] == always ? -1 : first[u];
+            for (size_t i = 0; i < active.size();) {
+                if (last[active[i]] < start) {
+                    freeSlots[size[active[i]]].push_back(newStart[active[i]]);
+                    active[i] = active.back();
+                    active.pop_back();
+                } else {
+                    i++;
+                }
+            }
+            std::vector<int>& pool = freeSlots[size[u]];
+            if (first[u] != always && !pool.empty()) {
+                newStart[u] = pool.back();
+                pool.pop_back();
+            } else {
+                newStart[u] = top;
+                top += size[u];
+            }
+            if (first[u] != always) active.push_back(u);
+        }
+
+        std::vector<int>& map = fp ? fpMap : ptrMap;
+        map.assign(numSlots, -1);
+        if (!fp)
+            for (int slot = 0; slot < reservedPtrSlots; slot++) map[slot] = slot;
+        for (int slot = 0; slot < numSlots; slot++) {
+            int u = unitOf[slot];
+            if (u >= 0 && newStart[u] >= 0) map[slot] = newStart[u] + slot - allocs[u];
+        }
+        if (fp) {
+            std::vector<double> newD(top, 0.);
+            for (int u = 0; u < numUnits; u++)
+                if (first[u] == always) std::copy(&d[allocs[u]], &d[allocs[u]] + size[u], &newD[newStart[u]]);
+            d.swap(newD);
+        } else {
+            std::vector<char*> newS(top, nullptr);
+            std::copy(s.begin(), s.begin() + reservedPtrSlots, newS.begin());
+            for (int u = 0; u < numUnits; u++)
+                if (first[u] == always) newS[newStart[u]] = s[allocs[u]];
+            s.swap(newS);
+        }
+    }
+
+    for (OpRecord& record : records)
+        for (size_t k = 0; k < record.operands.size(); k++) {
+            OperandKind kind = record.info[k].kind;
+            if (kind == okFPIN || kind == okFPOUT)
+                record.operands[k] = fpMap[record.operands[k]];
+            else if (kind == okPTRIN || kind == okPTROUT)
+                record.operands[k] = ptrMap[record.operands[k]];
+        }
+    for (Output& output : outputs) output.slot = output.kind == okFPIN ? fpMap[output.slot] : ptrMap[output.slot];
+    _fpAllocs.clear();
+    _ptrAllocs.clear();
+    return true;
+}
+
+void Interpreter::finalize(std::vector<Output>& outputs, bool constant) {
+    _varyingStart = _pcStart;
+    if ((foldConstants || eliminateCommon || fuseOps || reuseSlots || hoistUniform) && describedOps()) {
+        std::vector<OpRecord> records = unpackOps();
+        bool evaluated = foldConstants && constant && evalConstantProgram(records);
+        if (foldConstants && !evaluated) foldConstantOps(records);
+        if (eliminateCommon && !evaluated) eliminateCommonOps(records, outputs);
+        if (foldConstants && !evaluated) removeDeadOps(records, outputs);
+        if (hoistUniform) splitUniform(records);
+        if (fuseOps) fuse(records, outputs);
+        if (reuseSlots) {
+            std::vector<double> oldD = d;
+            std::vector<char*> oldS = s;
+            if (!allocateSlots(records, outputs)) {
+                d.swap(oldD);
+                s.swap(oldS);
+            }
+        }
+        packOps(records);
+    }
+    link();
+    _id = newId();  // frames set up for the program being built are stale
+
+    _callDepth = static_cast<int>(std::count_if(ops.begin(), ops.end(), [](const std::pair<OpF, int>& op) {
+        return op.first == ProcedureReturn;
+    }));
+    _batchable = true;
+    for (size_t pc = 0; pc < ops.size() && _batchable; pc++) {
+        OpF op = ops[pc].first;
+        if (op == CondJmpRelativeIfFalse::f || op == CondJmpRelativeIfTrue::f) {
+            // branches must have the if/else shape built by the nodes: [cond jmp] then [jmp to join] else [join]
+            int target = static_cast<int>(pc) + opData[ops[pc].second + 1];
+            _batchable = target > static_cast<int>(pc) + 1 && target <= static_cast<int>(ops.size()) &&
+                         ops[target - 1].first == JmpRelative::f && opData[ops[target - 1].second] > 0;
+        } else if (op != JmpRelative::f && op != ProcedureCall && op != ProcedureReturn && !batchOps[pc].f64) {
+            for (int k = ops[pc].second; k < opDataEnd(pc); k++) {
+                OperandKind kind = operandInfo[k].kind;
+                if (kind == okUNKNOWN || kind == okJUMP || kind == okPC) _batchable = false;
+            }
+        }
+    }
+}
+
+namespace {
+//! Copies a value of the given type between slots, promoting a scalar if fromDim is smaller
+void copyValue(Interpreter* interpreter, const ExprType& type, int fromDim, int from, int to) {
+    if (type.isFP()) {
+        int dim = type.dim();
+        if (fromDim != dim)
+            interpreter->addOp(getTemplatizedOp<Promote>(dim), getTemplatizedBatchOp<Promote>(dim));
+        else
+            interpreter->addOp(getTemplatizedOp<AssignOp>(dim), getTemplatizedBatchOp<AssignOp>(dim));
+        interpreter->addOperand(from, Interpreter::okFPIN, fromDim);
+        interpreter->addOperand(to, Interpreter::okFPOUT, dim);
+        interpreter->endOp();
+    } else {
+        interpreter->addOp(AssignStrOp::f, getBatchOp<AssignStrOp>());
+        interpreter->addOperand(from, Interpreter::okPTRIN);
+        interpreter->addOperand(to, Interpreter::okPTROUT);
+        interpreter->endOp(false);
+    }
+}
+}
+
+int ExprLocalFunctionNode::buildBody(Interpreter* interpreter) const {
+    int result = child(1)->buildInterpreter(interpreter);
+    ExprType returnType = prototype()->returnType();
+    int bodyDim = child(1)->type().dim();
+    if (!returnType.isFP() || bodyDim == returnType.dim()) return result;
+    int promoted = interpreter->allocFP(returnType.dim());
+    copyValue(interpreter, returnType, bodyDim, result, promoted);
+    return promoted;
+}
+
 int ExprLocalFunctionNode::buildInterpreter(Interpreter* interpreter) const {
+    // calls of functions that are expanded in place need no body of their own
+    _procedurePC = -1;
+    if (inlineCalls()) return 0;
+
+    // the body runs on ProcedureCall with the arguments in the prototype's slots
+    child(0)->buildInterpreter(interpreter);
     _procedurePC = interpreter->nextPC();
-    int lastOperand = 0;
-    for (int c = 0; c < numChildren(); c++) lastOperand = child(c)->buildInterpreter(interpreter);
+    _returnedDataOp = buildBody(interpreter);
     int basePC = interpreter->nextPC();
-    ;
     interpreter->addOp(ProcedureReturn);
-    // int endPC =
-    interpreter->addOperand(basePC);
+    interpreter->addOperand(basePC, Interpreter::okPC);
     interpreter->endOp(false);
-    _returnedDataOp = lastOperand;
-
     return 0;
 }
 
 int ExprLocalFunctionNode::buildInterpreterForCall(const ExprFuncNode* callerNode, Interpreter* interpreter) const {
+    // evaluate every argument before passing any, an argument may call this function too
     std::vector<int> operands;
+    for (int c = 0; c < callerNode->numChildren(); c++)
+        operands.push_back(callerNode->child(c)->buildInterpreter(interpreter));
+
+    bool inlined = _procedurePC < 0;
+    Interpreter::VarToLoc callerVarToLoc;
+    if (inlined) callerVarToLoc = interpreter->varToLoc;
     for (int c = 0; c < callerNode->numChildren(); c++) {
-        const ExprNode* child = callerNode->child(c);
-        // evaluate the argument
-        int operand = callerNode->child(c)->buildInterpreter(interpreter);
-        if (child->type().isFP()) {
-            if (callerNode->promote(c) != 0) {
-                // promote the argument to the needed type
-                interpreter->addOp(getTemplatizedOp<Promote>(callerNode->promote(c)));
-                // int promotedOperand=interpreter->allocFP(callerNode->promote(c));
-                interpreter->addOperand(operand);
-                interpreter->addOperand(prototype()->interpreterOps(c));
-                interpreter->endOp();
-            } else {
-                interpreter->addOp(getTemplatizedOp<AssignOp>(child->type().dim()));
-                interpreter->addOperand(operand);
-                interpreter->addOperand(prototype()->interpreterOps(c));
-                interpreter->endOp();
-            }
+        ExprType type = prototype()->argType(c);
+        int param = -1;
+        if (inlined) {
+            // an expanded call gets fresh slots for the parameters and, built from scratch, for the body's variables
+            param = type.isFP() ? interpreter->allocFP(type.dim()) : interpreter->allocPtr();
+            interpreter->varToLoc[static_cast<const ExprVarNode*>(prototype()->arg(c))->localVar()] = param;
         } else {
-            // TODO: string
-            assert(false);
+            param = prototype()->interpreterOps(c);
         }
-        operands.push_back(operand);
+        int fromDim = callerNode->promote(c) ? 1 : type.dim();
+        copyValue(interpreter, type, fromDim, operands[c], param);
+    }
+    if (inlined) {
+        int result = buildBody(interpreter);
+        interpreter->varToLoc.swap(callerVarToLoc);
+        return result;
     }
-    int outoperand = -1;
-    if (callerNode->type().isFP())
-        outoperand = interpreter->allocFP(callerNode->type().dim());
-    else if (callerNode->type().isString())
-        outoperand = interpreter->allocPtr();
-    else
-        assert(false);
 
     int basePC = interpreter->nextPC();
     interpreter->addOp(ProcedureCall);
-    int returnAddress = interpreter->addOperand(0);
-    interpreter->addOperand(_procedurePC - basePC);
+    int returnAddress = interpreter->addOperand(0, Interpreter::okPC);
+    interpreter->addOperand(_procedurePC - basePC, Interpreter::okJUMP);
     interpreter->endOp(false);
     // set return address
     interpreter->opData[returnAddress] = interpreter->nextPC();
 
-    // TODO: copy result back and string
-    interpreter->addOp(getTemplatizedOp<AssignOp>(callerNode->type().dim()));
-    interpreter->addOperand(_returnedDataOp);
-    interpreter->addOperand(outoperand);
-    interpreter->endOp();
-
+    // copy the result out before another call overwrites it
+    ExprType returnType = prototype()->returnType();
+    int outoperand = returnType.isFP() ? interpreter->allocFP(returnType.dim()) : interpreter->allocPtr();
+    copyValue(interpreter, returnType, returnType.dim(), _returnedDataOp, outoperand);
     return outoperand;
 }
 
@@ -548,7 +2023,7 @@ int ExprNumNode::buildInterpreter(Interpreter* interpreter) const {
 
 int ExprStrNode::buildInterpreter(Interpreter* interpreter) const {
     int loc = interpreter->allocPtr();
-    interpreter->s[loc] = const_cast<char*>(_str.c_str());
+    interpreter->s[loc] = const_cast<char*>(internString(_str));
     return loc;
 }
 
@@ -558,10 +2033,10 @@ int ExprVecNode::buildInterpreter(Interpreter* interpreter) const {
         const ExprNode* c = child(k);
         locs.push_back(c->buildInterpreter(interpreter));
     }
-    interpreter->addOp(getTemplatizedOp<Tuple>(numChildren()));
-    for (int k = 0; k < numChildren(); k++) interpreter->addOperand(locs[k]);
+    interpreter->addOp(getTemplatizedOp<Tuple>(numChildren()), getTemplatizedBatchOp<Tuple>(numChildren()));
+    for (int k = 0; k < numChildren(); k++) interpreter->addOperand(locs[k], Interpreter::okFPIN);
     int loc = interpreter->allocFP(numChildren());
-    interpreter->addOperand(loc);
+    interpreter->addOperand(loc, Interpreter::okFPOUT, numChildren());
     interpreter->endOp();
     return loc;
 }
@@ -573,18 +2048,18 @@ int ExprBinaryOpNode::buildInterpreter(Interpreter* interpreter) const {
     int op1 = child1->buildInterpreter(interpreter);
     if (dimout > 1) {
         if (dim0 != dimout) {
-            interpreter->addOp(getTemplatizedOp<Promote>(dimout));
+            interpreter->addOp(getTemplatizedOp<Promote>(dimout), getTemplatizedBatchOp<Promote>(dimout));
             int promoteOp0 = interpreter->allocFP(dimout);
-            interpreter->addOperand(op0);
-            interpreter->addOperand(promoteOp0);
+            interpreter->addOperand(op0, Interpreter::okFPIN);
+            interpreter->addOperand(promoteOp0, Interpreter::okFPOUT, dimout);
             op0 = promoteOp0;
             interpreter->endOp();
         }
         if (dim1 != dimout) {
-            interpreter->addOp(getTemplatizedOp<Promote>(dimout));
+            interpreter->addOp(getTemplatizedOp<Promote>(dimout), getTemplatizedBatchOp<Promote>(dimout));
             int promoteOp1 = interpreter->allocFP(dimout);
-            interpreter->addOperand(op1);
-            interpreter->addOperand(promoteOp1);
+            interpreter->addOperand(op1, Interpreter::okFPIN);
+            interpreter->addOperand(promoteOp1, Interpreter::okFPOUT, dimout);
             op1 = promoteOp1;
             interpreter->endOp();
         }
@@ -597,22 +2072,28 @@ int ExprBinaryOpNode::buildInterpreter(Interpreter* interpreter) const {
     if (isString == false) {
         switch (_op) {
             case '+':
-                interpreter->addOp(getTemplatizedOp2<'+', BinaryOp>(dimout));
+                interpreter->addOp(getTemplatizedOp2<'+', BinaryOp>(dimout),
+                                   getTemplatizedBatchOp2<'+', BinaryOp>(dimout));
                 break;
             case '-':
-                interpreter->addOp(getTemplatizedOp2<'-', BinaryOp>(dimout));
+                interpreter->addOp(getTemplatizedOp2<'-', BinaryOp>(dimout),
+                                   getTemplatizedBatchOp2<'-', BinaryOp>(dimout));
                 break;
             case '*':
-                interpreter->addOp(getTemplatizedOp2<'*', BinaryOp>(dimout));
+                interpreter->addOp(getTemplatizedOp2<'*', BinaryOp>(dimout),
+                                   getTemplatizedBatchOp2<'*', BinaryOp>(dimout));
                 break;
             case '/':
-                interpreter->addOp(getTemplatizedOp2<'/', BinaryOp>(dimout));
+                interpreter->addOp(getTemplatizedOp2<'/', BinaryOp>(dimout),
+                                   getTemplatizedBatchOp2<'/', BinaryOp>(dimout));
                 break;
             case '^':
-                interpreter->addOp(getTemplatizedOp2<'^', BinaryOp>(dimout));
+                interpreter->addOp(getTemplatizedOp2<'^', BinaryOp>(dimout),
+                                   getTemplatizedBatchOp2<'^', BinaryOp>(dimout));
                 break;
             case '%':
-                interpreter->addOp(getTemplatizedOp2<'%', BinaryOp>(dimout));
+                interpreter->addOp(getTemplatizedOp2<'%', BinaryOp>(dimout),
+                                   getTemplatizedBatchOp2<'%', BinaryOp>(dimout));
                 break;
             default:
                 assert(false);
@@ -621,9 +2102,6 @@ int ExprBinaryOpNode::buildInterpreter(Interpreter* interpreter) const {
         switch (_op) {
             case '+': {
                 interpreter->addOp(BinaryStringOp::f);
-                int intermediateOp = interpreter->allocPtr();
-                interpreter->s[intermediateOp] = (char*)(&_out);
-                interpreter->addOperand(intermediateOp);
                 break;
             }
             default:
@@ -639,9 +2117,15 @@ int ExprBinaryOpNode::buildInterpreter(Interpreter* interpreter) const {
         op2 = interpreter->allocPtr();
     }
 
-    interpreter->addOperand(op0);
-    interpreter->addOperand(op1);
-    interpreter->addOperand(op2);
+    if (isString == false) {
+        interpreter->addOperand(op0, Interpreter::okFPIN, dimout);
+        interpreter->addOperand(op1, Interpreter::okFPIN, dimout);
+        interpreter->addOperand(op2, Interpreter::okFPOUT, dimout);
+    } else {
+        interpreter->addOperand(op0, Interpreter::okPTRIN);
+        interpreter->addOperand(op1, Interpreter::okPTRIN);
+        interpreter->addOperand(op2, Interpreter::okPTROUT);
+    }
 
     // NOTE: one of the operand can be a function. If it's the case for
     // strings, since functions are not immediately executed (they have
@@ -662,20 +2146,20 @@ int ExprUnaryOpNode::buildInterpreter(Interpreter* interpreter) const {
 
     switch (_op) {
         case '-':
-            interpreter->addOp(getTemplatizedOp2<'-', UnaryOp>(dimout));
+            interpreter->addOp(getTemplatizedOp2<'-', UnaryOp>(dimout), getTemplatizedBatchOp2<'-', UnaryOp>(dimout));
             break;
         case '~':
-            interpreter->addOp(getTemplatizedOp2<'~', UnaryOp>(dimout));
+            interpreter->addOp(getTemplatizedOp2<'~', UnaryOp>(dimout), getTemplatizedBatchOp2<'~', UnaryOp>(dimout));
             break;
         case '!':
-            interpreter->addOp(getTemplatizedOp2<'!', UnaryOp>(dimout));
+            interpreter->addOp(getTemplatizedOp2<'!', UnaryOp>(dimout), getTemplatizedBatchOp2<'!', UnaryOp>(dimout));
             break;
         default:
             assert(false);
     }
     int op1 = interpreter->allocFP(dimout);
-    interpreter->addOperand(op0);
-    interpreter->addOperand(op1);
+    interpreter->addOperand(op0, Interpreter::okFPIN, dimout);
+    interpreter->addOperand(op1, Interpreter::okFPOUT, dimout);
     interpreter->endOp();
 
     return op1;
@@ -688,10 +2172,10 @@ int ExprSubscriptNode::buildInterpreter(Interpreter* interpreter) const {
     int op1 = child1->buildInterpreter(interpreter);
     int op2 = interpreter->allocFP(1);
 
-    interpreter->addOp(getTemplatizedOp<Subscript>(dimin));
-    interpreter->addOperand(op0);
-    interpreter->addOperand(op1);
-    interpreter->addOperand(op2);
+    interpreter->addOp(getTemplatizedOp<Subscript>(dimin), getTemplatizedBatchOp<Subscript>(dimin));
+    interpreter->addOperand(op0, Interpreter::okFPIN, dimin);
+    interpreter->addOperand(op1, Interpreter::okFPIN);
+    interpreter->addOperand(op2, Interpreter::okFPOUT);
     interpreter->endOp();
     return op2;
 }
@@ -713,21 +2197,69 @@ int ExprVarNode::buildInterpreter(Interpreter* interpreter) const {
         } else
             destLoc = interpreter->allocPtr();
         if (const auto* blockVarRef = dynamic_cast<const VarBlockCreator::Ref*>(var)) {
-            // TODO: handle strings
-            if (blockVarRef->type().isLifetimeUniform())
-                interpreter->addOp(getTemplatizedOp2<1, EvalVarBlockIndirect>(type.dim()));
-            else
-                interpreter->addOp(getTemplatizedOp2<0, EvalVarBlockIndirect>(type.dim()));
-            interpreter->addOperand(blockVarRef->offset());
-            interpreter->addOperand(destLoc);
-            interpreter->addOperand(blockVarRef->stride());
+            bool uniform = blockVarRef->type().isLifetimeUniform();
+            if (type.isString()) {
+                if (uniform)
+                    interpreter->addOp(EvalVarBlockIndirectStr<1>::f, getBatchOp<EvalVarBlockIndirectStr<1> >());
+                else
+                    interpreter->addOp(EvalVarBlockIndirectStr<0>::f, getBatchOp<EvalVarBlockIndirectStr<0> >());
+                interpreter->addOperand(blockVarRef->offset(), Interpreter::okIMMEDIATE);
+                interpreter->addOperand(destLoc, Interpreter::okPTROUT);
+                interpreter->endOp();
+                return destLoc;
+            }
+            // the element type of the data is the evaluation precision's unless the variable was given one
+            ChannelType elementType = blockVarRef->format().type;
+            if (elementType == ChannelType::Native)
+                elementType = interpreter->singlePrecision() ? ChannelType::Float32 : ChannelType::Float64;
+            int dim = type.dim();
+            switch (elementType) {
+                case ChannelType::Float32:
+                    if (uniform)
+                        interpreter->addOp(getTemplatizedOp2<1, EvalVarBlockIndirectFloat>(dim),
+                                           getTemplatizedBatchOp2<1, EvalVarBlockIndirectFloat>(dim));
+                    else
+                        interpreter->addOp(getTemplatizedOp2<0, EvalVarBlockIndirectFloat>(dim),
+                                           getTemplatizedBatchOp2<0, EvalVarBlockIndirectFloat>(dim));
+                    break;
+                case ChannelType::Half:
+                    if (uniform)
+                        interpreter->addOp(getTemplatizedOp2<1, EvalVarBlockIndirectHalf>(dim),
+                                           getTemplatizedBatchOp2<1, EvalVarBlockIndirectHalf>(dim));
+                    else
+                        interpreter->addOp(getTemplatizedOp2<0, EvalVarBlockIndirectHalf>(dim),
+                                           getTemplatizedBatchOp2<0, EvalVarBlockIndirectHalf>(dim));
+                    break;
+                case ChannelType::UInt8:
+                    if (uniform)
+                        interpreter->addOp(getTemplatizedOp2<1, EvalVarBlockIndirectUInt8>(dim),
+                                           getTemplatizedBatchOp2<1, EvalVarBlockIndirectUInt8>(dim));
+                    else
+                        interpreter->addOp(getTemplatizedOp2<0, EvalVarBlockIndirectUInt8>(dim),
+                                           getTemplatizedBatchOp2<0, EvalVarBlockIndirectUInt8>(dim));
+                    break;
+                default:
+                    if (uniform)
+                        interpreter->addOp(getTemplatizedOp2<1, EvalVarBlockIndirect>(dim),
+                                           getTemplatizedBatchOp2<1, EvalVarBlockIndirect>(dim));
+                    else
+                        interpreter->addOp(getTemplatizedOp2<0, EvalVarBlockIndirect>(dim),
+                                           getTemplatizedBatchOp2<0, EvalVarBlockIndirect>(dim));
+                    break;
+            }
+            interpreter->addOperand(blockVarRef->offset(), Interpreter::okIMMEDIATE);
+            interpreter->addOperand(destLoc, Interpreter::okFPOUT, type.dim());
+            interpreter->addOperand(blockVarRef->stride(), Interpreter::okIMMEDIATE);
             interpreter->endOp();
         } else {
             int varRefLoc = interpreter->allocPtr();
             interpreter->addOp(EvalVar::f);
             interpreter->s[varRefLoc] = const_cast<char*>(reinterpret_cast<const char*>(var));
-            interpreter->addOperand(varRefLoc);
-            interpreter->addOperand(destLoc);
+            interpreter->addOperand(varRefLoc, Interpreter::okPTRIN);
+            if (type.isFP())
+                interpreter->addOperand(destLoc, Interpreter::okFPOUT, type.dim());
+            else
+                interpreter->addOperand(destLoc, Interpreter::okPTROUT);
             interpreter->endOp();
         }
         return destLoc;
@@ -736,6 +2268,9 @@ int ExprVarNode::buildInterpreter(Interpreter* interpreter) const {
 }
 
 int ExprLocalVar::buildInterpreter(Interpreter* interpreter) const {
+    // a branch variable may already share the slot of the phi it merges into
+    Interpreter::VarToLoc::const_iterator it = interpreter->varToLoc.find(this);
+    if (it != interpreter->varToLoc.end()) return it->second;
     return interpreter->varToLoc[this] =
                _type.isFP() ? interpreter->allocFP(_type.dim()) : _type.isString() ? interpreter->allocPtr() : -1;
 }
@@ -747,35 +2282,40 @@ int ExprAssignNode::buildInterpreter(Interpreter* interpreter) const {
     ExprType child0Type = child(0)->type();
     int op0 = child(0)->buildInterpreter(interpreter);
     if (child0Type.isFP()) {
-        interpreter->addOp(getTemplatizedOp<AssignOp>(child0Type.dim()));
+        int dim = child0Type.dim();
+        interpreter->addOp(getTemplatizedOp<AssignOp>(dim), getTemplatizedBatchOp<AssignOp>(dim));
+        interpreter->addOperand(op0, Interpreter::okFPIN, dim);
+        interpreter->addOperand(loc, Interpreter::okFPOUT, dim);
     } else if (child0Type.isString()) {
-        interpreter->addOp(AssignStrOp::f);
+        interpreter->addOp(AssignStrOp::f, getBatchOp<AssignStrOp>());
+        interpreter->addOperand(op0, Interpreter::okPTRIN);
+        interpreter->addOperand(loc, Interpreter::okPTROUT);
     } else {
         assert(false && "Invalid desired assign type");
         return -1;
     }
-    interpreter->addOperand(op0);
-    interpreter->addOperand(loc);
     interpreter->endOp(child0Type.isString() == false);
     return loc;
 }
 
 void copyVarToPromotedPosition(Interpreter* interpreter, ExprLocalVar* varSource, ExprLocalVar* varDest) {
+    if (interpreter->varToLoc[varSource] == interpreter->varToLoc[varDest]) return;  // coalesced with the phi
     if (varDest->type().isFP()) {
         int destDim = varDest->type().dim();
-        if (destDim != varSource->type().dim()) {
-            assert(varSource->type().dim() == 1);
-            interpreter->addOp(getTemplatizedOp<Promote>(destDim));
+        int sourceDim = varSource->type().dim();
+        if (destDim != sourceDim) {
+            assert(sourceDim == 1);
+            interpreter->addOp(getTemplatizedOp<Promote>(destDim), getTemplatizedBatchOp<Promote>(destDim));
         } else {
-            interpreter->addOp(getTemplatizedOp<AssignOp>(destDim));
+            interpreter->addOp(getTemplatizedOp<AssignOp>(destDim), getTemplatizedBatchOp<AssignOp>(destDim));
         }
-        interpreter->addOperand(interpreter->varToLoc[varSource]);
-        interpreter->addOperand(interpreter->varToLoc[varDest]);
+        interpreter->addOperand(interpreter->varToLoc[varSource], Interpreter::okFPIN, sourceDim);
+        interpreter->addOperand(interpreter->varToLoc[varDest], Interpreter::okFPOUT, destDim);
         interpreter->endOp();
     } else if (varDest->type().isString()) {
-        interpreter->addOp(AssignStrOp::f);
-        interpreter->addOperand(interpreter->varToLoc[varSource]);
-        interpreter->addOperand(interpreter->varToLoc[varDest]);
+        interpreter->addOp(AssignStrOp::f, getBatchOp<AssignStrOp>());
+        interpreter->addOperand(interpreter->varToLoc[varSource], Interpreter::okPTRIN);
+        interpreter->addOperand(interpreter->varToLoc[varDest], Interpreter::okPTROUT);
         interpreter->endOp();
     } else {
         assert(false && "failed to promote invalid type");
@@ -790,17 +2330,25 @@ int ExprIfThenElseNode::buildInterpreter(Interpreter* interpreter) const {
     // Allocate spots for all the join variables
     // they are before in the sequence of operands, but it doesn't matter
     // NOTE: at this point the variables thenVar and elseVar have not been codegen'd
+    // A branch variable that is only defined inside its branch and has the phi's exact type is placed directly in
+    // the phi's slot, so no copy is needed at the end of the branch
     for (auto& it : merges) {
         ExprLocalVarPhi* finalVar = it.second;
         if (finalVar->valid()) {
-            finalVar->buildInterpreter(interpreter);
+            int loc = finalVar->buildInterpreter(interpreter);
+            const ExprType& type = finalVar->type();
+            for (ExprLocalVar* branchVar : {finalVar->_thenVar, finalVar->_elseVar}) {
+                const ExprType& branchType = branchVar->type();
+                bool sameType = type.isFP() ? branchType.isFP(type.dim()) : type.isString() && branchType.isString();
+                if (sameType && !interpreter->varToLoc.count(branchVar)) interpreter->varToLoc[branchVar] = loc;
+            }
         }
     }
 
     // Setup the conditional jump
     interpreter->addOp(CondJmpRelativeIfFalse::f);
-    interpreter->addOperand(condop);
-    int destFalse = interpreter->addOperand(0);
+    interpreter->addOperand(condop, Interpreter::okFPIN);
+    int destFalse = interpreter->addOperand(0, Interpreter::okJUMP);
     interpreter->endOp();
 
     // Then block (build interpreter and copy variables out then jump to end)
@@ -812,7 +2360,7 @@ int ExprIfThenElseNode::buildInterpreter(Interpreter* interpreter) const {
         }
     }
     interpreter->addOp(JmpRelative::f);
-    int destEnd = interpreter->addOperand(0);
+    int destEnd = interpreter->addOperand(0, Interpreter::okJUMP);
     interpreter->endOp();
 
     // Else block (build interpreter, copy variables out and then we're at end)
@@ -846,26 +2394,29 @@ int ExprCompareNode::buildInterpreter(Interpreter* interpreter) const {
         // conditional to check if that argument could continue
         int basePC = (interpreter->nextPC());
         interpreter->addOp(_op == '&' ? CondJmpRelativeIfFalse::f : CondJmpRelativeIfTrue::f);
-        interpreter->addOperand(op0);
-        int destFalse = interpreter->addOperand(0);
+        interpreter->addOperand(op0, Interpreter::okFPIN);
+        int destFalse = interpreter->addOperand(0, Interpreter::okJUMP);
         interpreter->endOp();
         // this is the no-branch case (op1=true for & and op0=false for |), so eval op1
         int op1 = child1->buildInterpreter(interpreter);
         // combine with &
-        interpreter->addOp(_op == '&' ? getTemplatizedOp2<'&', BinaryOp>(1) : getTemplatizedOp2<'|', BinaryOp>(1));
-        interpreter->addOperand(op0);
-        interpreter->addOperand(op1);
-        interpreter->addOperand(op2);
+        if (_op == '&')
+            interpreter->addOp(getTemplatizedOp2<'&', BinaryOp>(1), getTemplatizedBatchOp2<'&', BinaryOp>(1));
+        else
+            interpreter->addOp(getTemplatizedOp2<'|', BinaryOp>(1), getTemplatizedBatchOp2<'|', BinaryOp>(1));
+        interpreter->addOperand(op0, Interpreter::okFPIN);
+        interpreter->addOperand(op1, Interpreter::okFPIN);
+        interpreter->addOperand(op2, Interpreter::okFPOUT);
         interpreter->endOp();
         interpreter->addOp(JmpRelative::f);
-        int destEnd = interpreter->addOperand(0);
+        int destEnd = interpreter->addOperand(0, Interpreter::okJUMP);
         interpreter->endOp();
         // this is the branch case (op1=false for & and op0=true for |) so no eval of op1 required
         // just copy from the op0's value
         int falseConditionPC = interpreter->nextPC();
-        interpreter->addOp(AssignOp<1>::f);
-        interpreter->addOperand(op0);
-        interpreter->addOperand(op2);
+        interpreter->addOp(AssignOp<1>::f, getBatchOp<AssignOp<1> >());
+        interpreter->addOperand(op0, Interpreter::okFPIN);
+        interpreter->addOperand(op2, Interpreter::okFPOUT);
         interpreter->endOp();
 
         // fix PC relative jump addressses
@@ -880,16 +2431,16 @@ int ExprCompareNode::buildInterpreter(Interpreter* interpreter) const {
         int op1 = child1->buildInterpreter(interpreter);
         switch (_op) {
             case '<':
-                interpreter->addOp(getTemplatizedOp2<'<', BinaryOp>(1));
+                interpreter->addOp(getTemplatizedOp2<'<', BinaryOp>(1), getTemplatizedBatchOp2<'<', BinaryOp>(1));
                 break;
             case '>':
-                interpreter->addOp(getTemplatizedOp2<'>', BinaryOp>(1));
+                interpreter->addOp(getTemplatizedOp2<'>', BinaryOp>(1), getTemplatizedBatchOp2<'>', BinaryOp>(1));
                 break;
             case 'l':
-                interpreter->addOp(getTemplatizedOp2<'l', BinaryOp>(1));
+                interpreter->addOp(getTemplatizedOp2<'l', BinaryOp>(1), getTemplatizedBatchOp2<'l', BinaryOp>(1));
                 break;
             case 'g':
-                interpreter->addOp(getTemplatizedOp2<'g', BinaryOp>(1));
+                interpreter->addOp(getTemplatizedOp2<'g', BinaryOp>(1), getTemplatizedBatchOp2<'g', BinaryOp>(1));
                 break;
             case '&':
                 assert(false);  // interpreter->addOp(getTemplatizedOp2<'&',BinaryOp>(1));break;
@@ -899,31 +2450,23 @@ int ExprCompareNode::buildInterpreter(Interpreter* interpreter) const {
                 assert(false);
         }
         int op2 = interpreter->allocFP(1);
-        interpreter->addOperand(op0);
-        interpreter->addOperand(op1);
-        interpreter->addOperand(op2);
+        interpreter->addOperand(op0, Interpreter::okFPIN);
+        interpreter->addOperand(op1, Interpreter::okFPIN);
+        interpreter->addOperand(op2, Interpreter::okFPOUT);
         interpreter->endOp();
         return op2;
     }
 }
 
 int ExprPrototypeNode::buildInterpreter(Interpreter* interpreter) const {
-    // set up parents
+    // make sure we have a slot in our global activation record for the parameters
     _interpreterOps.clear();
     for (int c = 0; c < numChildren(); c++) {
-        if (const ExprVarNode* childVarNode = dynamic_cast<const ExprVarNode*>(child(c))) {
-            ExprType childType = childVarNode->type();
-            if (childType.isFP()) {
-                int operand = interpreter->allocFP(childType.dim());
-                _interpreterOps.push_back(operand);
-                interpreter->varToLoc[childVarNode->localVar()] = operand;
-            }
-        } else {
-            assert(false);
-        }
-        child(c)->buildInterpreter(interpreter);
-
-        // make sure we have a slot in our global activation record for the variables!
+        const ExprVarNode* childVarNode = static_cast<const ExprVarNode*>(child(c));
+        ExprType type = argType(c);
+        int operand = type.isFP() ? interpreter->allocFP(type.dim()) : interpreter->allocPtr();
+        _interpreterOps.push_back(operand);
+        interpreter->varToLoc[childVarNode->localVar()] = operand;
     }
     return 0;
 }
@@ -938,41 +2481,47 @@ int ExprCompareEqNode::buildInterpreter(Interpreter* interpreter) const {
         int dimCompare = std::max(dim0, dim1);
         if (dimCompare > 1) {
             if (dim0 == 1) {
-                interpreter->addOp(getTemplatizedOp<Promote>(dim1));
+                interpreter->addOp(getTemplatizedOp<Promote>(dim1), getTemplatizedBatchOp<Promote>(dim1));
                 int promotedOp0 = interpreter->allocFP(dim1);
-                interpreter->addOperand(op0);
-                interpreter->addOperand(promotedOp0);
+                interpreter->addOperand(op0, Interpreter::okFPIN);
+                interpreter->addOperand(promotedOp0, Interpreter::okFPOUT, dim1);
                 interpreter->endOp();
                 op0 = promotedOp0;
             }
             if (dim1 == 1) {
-                interpreter->addOp(getTemplatizedOp<Promote>(dim0));
+                interpreter->addOp(getTemplatizedOp<Promote>(dim0), getTemplatizedBatchOp<Promote>(dim0));
                 int promotedOp1 = interpreter->allocFP(dim0);
-                interpreter->addOperand(op1);
-                interpreter->addOperand(promotedOp1);
+                interpreter->addOperand(op1, Interpreter::okFPIN);
+                interpreter->addOperand(promotedOp1, Interpreter::okFPOUT, dim0);
                 interpreter->endOp();
                 op1 = promotedOp1;
             }
         }
         if (_op == '=')
-            interpreter->addOp(getTemplatizedOp2<'=', CompareEqOp>(dimCompare));
+            interpreter->addOp(getTemplatizedOp2<'=', CompareEqOp>(dimCompare),
+                               getTemplatizedBatchOp2<'=', CompareEqOp>(dimCompare));
         else if (_op == '!')
-            interpreter->addOp(getTemplatizedOp2<'!', CompareEqOp>(dimCompare));
+            interpreter->addOp(getTemplatizedOp2<'!', CompareEqOp>(dimCompare),
+                               getTemplatizedBatchOp2<'!', CompareEqOp>(dimCompare));
         else
             assert(false && "Invalid operation");
+        interpreter->addOperand(op0, Interpreter::okFPIN, dimCompare);
+        interpreter->addOperand(op1, Interpreter::okFPIN, dimCompare);
     } else if (child0->type().isString()) {
         if (_op == '=')
-            interpreter->addOp(getTemplatizedOp2<'=', StrCompareEqOp>(1));
+            interpreter->addOp(getTemplatizedOp2<'=', StrCompareEqOp>(1),
+                               getTemplatizedBatchOp2<'=', StrCompareEqOp>(1));
         else if (_op == '!')
-            interpreter->addOp(getTemplatizedOp2<'!', StrCompareEqOp>(1));
+            interpreter->addOp(getTemplatizedOp2<'!', StrCompareEqOp>(1),
+                               getTemplatizedBatchOp2<'!', StrCompareEqOp>(1));
         else
             assert(false && "Invalid operation");
+        interpreter->addOperand(op0, Interpreter::okPTRIN);
+        interpreter->addOperand(op1, Interpreter::okPTRIN);
     } else
         assert(false && "Invalid type for comparison");
     int op2 = interpreter->allocFP(1);
-    interpreter->addOperand(op0);
-    interpreter->addOperand(op1);
-    interpreter->addOperand(op2);
+    interpreter->addOperand(op2, Interpreter::okFPOUT);
     interpreter->endOp(child0->type().isString() == false);
     return op2;
 }
@@ -986,25 +2535,36 @@ int ExprCondNode::buildInterpreter(Interpreter* interpreter) const {
     int condOp = child(0)->buildInterpreter(interpreter);
     int basePC = (interpreter->nextPC());
     interpreter->addOp(CondJmpRelativeIfFalse::f);
-    interpreter->addOperand(condOp);
-    int destFalse = interpreter->addOperand(0);
+    interpreter->addOperand(condOp, Interpreter::okFPIN);
+    int destFalse = interpreter->addOperand(0, Interpreter::okJUMP);
     interpreter->endOp();
 
     // true way of working
     int op1 = child(1)->buildInterpreter(interpreter);
-    if (type().isFP())
-        interpreter->addOp(getTemplatizedOp<AssignOp>(dimout));
-    else if (type().isString())
-        interpreter->addOp(AssignStrOp::f);
-    else
+    if (type().isFP() && dimout > 1 && child(1)->type().isFP(1)) {
+        int promotedOp = interpreter->allocFP(dimout);
+        interpreter->addOp(getTemplatizedOp<Promote>(dimout), getTemplatizedBatchOp<Promote>(dimout));
+        interpreter->addOperand(op1, Interpreter::okFPIN);
+        interpreter->addOperand(promotedOp, Interpreter::okFPOUT, dimout);
+        interpreter->endOp(false);
+        op1 = promotedOp;
+    }
+    int dataOutTrue = -1;
+    if (type().isFP()) {
+        interpreter->addOp(getTemplatizedOp<AssignOp>(dimout), getTemplatizedBatchOp<AssignOp>(dimout));
+        interpreter->addOperand(op1, Interpreter::okFPIN, dimout);
+        dataOutTrue = interpreter->addOperand(-1, Interpreter::okFPOUT, dimout);
+    } else if (type().isString()) {
+        interpreter->addOp(AssignStrOp::f, getBatchOp<AssignStrOp>());
+        interpreter->addOperand(op1, Interpreter::okPTRIN);
+        dataOutTrue = interpreter->addOperand(-1, Interpreter::okPTROUT);
+    } else
         assert(false);
-    interpreter->addOperand(op1);
-    int dataOutTrue = interpreter->addOperand(-1);
     interpreter->endOp(false);
 
     // jump past false way of working
     interpreter->addOp(JmpRelative::f);
-    int destEnd = interpreter->addOperand(0);
+    int destEnd = interpreter->addOperand(0, Interpreter::okJUMP);
     interpreter->endOp();
 
     // record start of false condition
@@ -1012,14 +2572,25 @@ int ExprCondNode::buildInterpreter(Interpreter* interpreter) const {
 
     // false way of working
     int op2 = child(2)->buildInterpreter(interpreter);
-    if (type().isFP())
-        interpreter->addOp(getTemplatizedOp<AssignOp>(dimout));
-    else if (type().isString())
-        interpreter->addOp(AssignStrOp::f);
-    else
+    if (type().isFP() && dimout > 1 && child(2)->type().isFP(1)) {
+        int promotedOp = interpreter->allocFP(dimout);
+        interpreter->addOp(getTemplatizedOp<Promote>(dimout), getTemplatizedBatchOp<Promote>(dimout));
+        interpreter->addOperand(op2, Interpreter::okFPIN);
+        interpreter->addOperand(promotedOp, Interpreter::okFPOUT, dimout);
+        interpreter->endOp(false);
+        op2 = promotedOp;
+    }
+    int dataOutFalse = -1;
+    if (type().isFP()) {
+        interpreter->addOp(getTemplatizedOp<AssignOp>(dimout), getTemplatizedBatchOp<AssignOp>(dimout));
+        interpreter->addOperand(op2, Interpreter::okFPIN, dimout);
+        dataOutFalse = interpreter->addOperand(-1, Interpreter::okFPOUT, dimout);
+    } else if (type().isString()) {
+        interpreter->addOp(AssignStrOp::f, getBatchOp<AssignStrOp>());
+        interpreter->addOperand(op2, Interpreter::okPTRIN);
+        dataOutFalse = interpreter->addOperand(-1, Interpreter::okPTROUT);
+    } else
         assert(false);
-    interpreter->addOperand(op2);
-    int dataOutFalse = interpreter->addOperand(-1);
     interpreter->endOp(false);
 
     // patch up relative jumps
@@ -1048,11 +2619,16 @@ int ExprBlockNode::buildInterpreter(Interpreter* interpreter) const {
 }
 
 int ExprModuleNode::buildInterpreter(Interpreter* interpreter) const {
-    int lastIdx = 0;
-    for (int c = 0; c < numChildren(); c++) {
-        if (c == numChildren() - 1) interpreter->setPCStart(interpreter->nextPC());
-        lastIdx = child(c)->buildInterpreter(interpreter);
-    }
-    return lastIdx;
+    buildInterpreterForFunctions(interpreter);
+    interpreter->setPCStart(interpreter->nextPC());
+    return buildInterpreterForBody(interpreter);
+}
+
+void ExprModuleNode::buildInterpreterForFunctions(Interpreter* interpreter) const {
+    for (int c = 0; c < numChildren() - 1; c++) child(c)->buildInterpreter(interpreter);
+}
+
+int ExprModuleNode::buildInterpreterForBody(Interpreter* interpreter) const {
+    return numChildren() ? child(numChildren() - 1)->buildInterpreter(interpreter) : 0;
 }
 }
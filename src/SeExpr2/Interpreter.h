@@ -17,11 +17,28 @@
 #ifndef _Interpreter_h_
 #define _Interpreter_h_
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <stack>
+#include "StringArena.h"
+#include "CPUDispatch.h"
+#include "Channel.h"
 
 namespace SeExpr2 {
 class ExprLocalVar;
+class VarBlock;
+
+//! Calls f(lane) for every active lane of a batch. A null lane list means lanes [0,numLanes) are all active; that
+//! is the common case and is kept as a plain counted loop so that the compiler can vectorize the op kernels.
+template <class F>
+inline void forEachLane(const int* lanes, int numLanes, F f) {
+    if (lanes) {
+        for (int i = 0; i < numLanes; i++) f(lanes[i]);
+    } else {
+        for (int l = 0; l < numLanes; l++) f(l);
+    }
+}
 
 //! Promotes a FP[1] to FP[d]
 template <int d>
@@ -33,50 +50,227 @@ struct Promote {
         for (int k = posOut; k < posOut + d; k++) fp[k] = fp[posIn];
         return 1;
     }
+    template <class T>
+    static void batch(int* opData, T* fp, char** c, const int* lanes, int numLanes);
+};
+
+template <class T>
+struct InterpreterBatchFrame;
+
+//! Mutable working data of an Interpreter evaluation. A frame is initialised from the program's data on its first use
+//! and reused after that, so threads sharing one program only need a frame each.
+struct InterpreterFrame {
+    InterpreterFrame();
+    ~InterpreterFrame();
+
+    /// Working copy of the program's double and pointer data
+    std::vector<double> d;
+    std::vector<char*> s;
+    /// Return addresses of the local function calls in progress. It is sized for the deepest possible nesting when the
+    /// frame is set up, element 0 holds the current depth.
+    std::vector<int> callStack;
+    /// Strings built by the evaluation (reset by every eval, the uniform prologue's strings are kept until the mark)
+    StringArena strings;
+    StringArena::Mark varyingStrings = {0, 0};
+    /// Id of the program the frame was initialised for (0 if none)
+    size_t program = 0;
+    /// When the frame was last used, in evaluations with its variable block (see InterpreterFrames)
+    size_t lastUse = 0;
+    /// Lanes evalMultiple works on (created by its first batched evaluation with the frame)
+    std::unique_ptr<InterpreterBatchFrame<double>> batch;
+    std::unique_ptr<InterpreterBatchFrame<float>> floatBatch;
+};
+
+//! The interpreter frames of a thread safe variable block, by program id. Only the frames of the maxPrograms most
+//! recently used programs are kept, so a block cycling through many expressions doesn't pile them up.
+struct InterpreterFrames {
+    static const size_t maxPrograms = 16;
+    std::unordered_map<size_t, std::unique_ptr<InterpreterFrame>> frames;
+    size_t uses = 0;
 };
 
 /// Non-LLVM manual interpreter. This is a simple computation machine. There are no dynamic activation records
 /// just fixed locations, because we have no recursion!
 class Interpreter {
   public:
-    /// Double data (constants and evaluated)
+    /// Double data (constants and values computed while building, evaluation works on a copy in a frame)
     std::vector<double> d;
-    /// constant and evaluated pointer data
+    /// Constant pointer data (likewise copied to a frame)
     std::vector<char*> s;
     /// Ooperands to op
     std::vector<int> opData;
 
+    /// How an op uses one of its operands. Ops whose operands are all described can be run by the batch evaluator
+    /// even without a dedicated batch kernel.
+    enum OperandKind {
+        okUNKNOWN = 0,  ///< not described, the op is opaque
+        okIMMEDIATE,    ///< plain integer (offsets, counts, strides)
+        okFPIN,         ///< reads fp[operand] .. fp[operand+dim-1]
+        okFPOUT,        ///< writes fp[operand] .. fp[operand+dim-1]
+        okPTRIN,        ///< reads c[operand]
+        okPTROUT,       ///< writes c[operand]
+        okJUMP,         ///< pc offset relative to the op
+        okPC            ///< absolute pc
+    };
+    struct OperandInfo {
+        OperandKind kind;
+        int dim;
+    };
+    /// Description of each entry of opData (parallel to opData)
+    std::vector<OperandInfo> operandInfo;
+    /// A value the caller reads after evaluation: the dim values at slot, read as described by kind (okFPIN or
+    /// okPTRIN). evalMultiple writes it to its output variable as format says (natively if zero).
+    struct Output {
+        int slot;
+        OperandKind kind;
+        int dim;
+        ChannelFormat format;
+    };
+
     /// Not needed for eval only building
     typedef std::map<const ExprLocalVar*, int> VarToLoc;
     VarToLoc varToLoc;
 
     /// Op function pointer arguments are (int* currOpData,double* currD,char** c,std::stack<int>& callStackurrS)
     typedef int (*OpF)(int*, double*, char**, std::vector<int>&);
+    /// Batch op function pointer arguments are (int* currOpData,double* batchD,char** batchC,const int* lanes,int
+    /// numLanes). Slot k of lane l lives at batchD[k*batchSize+l] (likewise for batchC).
+    typedef void (*BatchOpF)(int*, double*, char**, const int*, int);
+    /// Batch op function pointer working on single precision lanes (see singlePrecision())
+    typedef void (*BatchOpF32)(int*, float*, char**, const int*, int);
+    /// The batch kernels of an op for both lane precisions (null if the op has none)
+    struct BatchOp {
+        BatchOpF f64;
+        BatchOpF32 f32;
+        BatchOp(BatchOpF f64 = nullptr, BatchOpF32 f32 = nullptr) : f64(f64), f32(f32) {}
+        BatchOpF kernel(double*) const { return f64; }
+        BatchOpF32 kernel(float*) const { return f32; }
+    };
+
+    /// Number of points evaluated together by evalMultiple
+    static const int batchSize = 8;
+    /// Pointer slot holding the StringArena* that ops building strings allocate from (slots 0 and 1 hold the variable
+    /// block data and the indirect index)
+    static const int stringArenaSlot = 2;
+    /// Number of pointer slots reserved at the start of s
+    static const int reservedPtrSlots = 3;
+
+    /// Whether finalize fuses common op sequences into superinstructions (defaults to on, SE_EXPR_FUSE=0 turns it off)
+    static bool fuseOps;
+    /// Whether finalize reassigns slots so temporaries with disjoint lifetimes share storage (defaults to on,
+    /// SE_EXPR_REUSE_SLOTS=0 turns it off)
+    static bool reuseSlots;
+    /// Whether finalize moves the ops that only depend on uniform data into a prologue run once per evalMultiple
+    /// (defaults to on, SE_EXPR_HOIST_UNIFORM=0 turns it off)
+    static bool hoistUniform;
+    /// Whether finalize folds ops computing only from constants and removes ops whose results are unused (defaults to
+    /// on, SE_EXPR_FOLD=0 turns it off)
+    static bool foldConstants;
+    /// Whether finalize replaces ops repeating the computation of an earlier op with its result, e.g. the variable
+    /// loads and subexpressions shared by the expressions of a group (defaults to on, SE_EXPR_CSE=0 turns it off)
+    static bool eliminateCommon;
 
     std::vector<std::pair<OpF, int> > ops;
+    /// Batch kernel of each op (parallel to ops, may be null)
+    std::vector<BatchOp> batchOps;
     std::vector<int> callStack;
 
   private:
     bool _startedOp;
     int _pcStart;
+    /// First op of the varying body. Ops in [_pcStart,_varyingStart) only depend on uniform data, so evalMultiple
+    /// runs them once per call rather than once per point.
+    int _varyingStart;
+    bool _batchable;
+    /// Whether the variable block holds float data and evalMultiple works on float lanes
+    bool _singlePrecision;
+    /// Deepest possible nesting of local function calls (each out of line body is entered at most once at a time)
+    int _callDepth;
+    /// Identifies the finalized program for frames (unique among all interpreters)
+    size_t _id;
+    /// Frame used when evaluating without a thread safe variable block
+    mutable InterpreterFrame _frame;
+    /// Strings built while building the program (e.g. folded constants), they live as long as the program
+    StringArena _strings;
+    static size_t newId();
+    /// First slot of every allocFP and allocPtr allocation (the slots of one allocation stay together)
+    std::vector<int> _fpAllocs, _ptrAllocs;
+
+    /// Linked program used by eval. Every op is stored as one record [handler][record size][pc][operands...] so the
+    /// handler and its operands are adjacent and the next op follows directly (records are padded to keep handlers
+    /// aligned).
+    std::vector<int> _code;
+    /// Offset of each op's record in _code, plus one past the last record
+    std::vector<int> _codePC;
+    static const int codeHandlerWords = (sizeof(OpF) + sizeof(int) - 1) / sizeof(int);
+    static const int codeHeaderWords = codeHandlerWords + 2;
+    void link();
+
+    /// One past the last operand of the op at pc
+    int opDataEnd(int pc) const {
+        return pc + 1 < static_cast<int>(ops.size()) ? ops[pc + 1].second : static_cast<int>(opData.size());
+    }
+
+    /// An op and its operands while the optimization passes rewrite the program
+    struct OpRecord;
+    std::vector<OpRecord> unpackOps() const;
+    void packOps(const std::vector<OpRecord>& records);
+    bool describedOps() const;
+    /// Whether the op depends on more than its operands: the point being evaluated, host variables or custom
+    /// functions (which may have side effects)
+    static bool pointDependent(OpF op);
+    /// Whether the op loads a uniform variable (which is not known until evaluation)
+    static bool uniformLoad(OpF op);
+    bool evalConstantProgram(std::vector<OpRecord>& records);
+    void foldConstantOps(std::vector<OpRecord>& records);
+    void eliminateCommonOps(std::vector<OpRecord>& records, std::vector<Output>& outputs) const;
+    void removeDeadOps(std::vector<OpRecord>& records, const std::vector<Output>& outputs);
+    void splitUniform(std::vector<OpRecord>& records);
+    void fuse(std::vector<OpRecord>& records, const std::vector<Output>& outputs) const;
+    bool allocateSlots(std::vector<OpRecord>& records, std::vector<Output>& outputs);
+
+    void setUp(InterpreterFrame& frame) const;
+    void run(double* fp, char** str, std::vector<int>& callStack, int pcBegin, int pcEnd, bool debug) const;
+    template <class T>
+    using BatchFrame = InterpreterBatchFrame<T>;
+    void evalPoints(InterpreterFrame& frame, bool& started, VarBlock* block, bool setIndex,
+                    const std::vector<Output>& outputs, const int* outputVarBlockOffsets, size_t rangeStart,
+                    size_t rangeEnd, const uint32_t* indices) const;
+    template <class T>
+    BatchFrame<T>& startBatch(std::unique_ptr<BatchFrame<T>>& frame, VarBlock* block) const;
+    template <class T>
+    void evalBatches(BatchFrame<T>& frame, char** data, const std::vector<Output>& outputs,
+                     const int* outputVarBlockOffsets, size_t rangeStart, size_t rangeEnd,
+                     const uint32_t* indices) const;
+    template <class T>
+    void evalBatch(int pcBegin, int pcEnd, BatchFrame<T>& frame, const int* lanes, int numLanes) const;
+    template <class T>
+    void evalLane(int pc, BatchFrame<T>& frame, int lane) const;
 
   public:
-    Interpreter() : _startedOp(false) {
+    /// A single precision program reads float variable block data and evalMultiple writes float outputs. Scalar
+    /// evaluation still computes in double; batches keep their values on float lanes, but function calls compute
+    /// in double on the widened lane values.
+    explicit Interpreter(bool singlePrecision = false)
+        : _startedOp(false), _pcStart(0), _varyingStart(0), _batchable(false), _singlePrecision(singlePrecision),
+          _callDepth(0), _id(newId()) {
         s.push_back(nullptr);  // reserved for double** of variable block
         s.push_back(nullptr);  // reserved for double** of variable block
+        s.push_back(reinterpret_cast<char*>(&_strings));  // reserved for the string arena
     }
 
     /// Return the position that the next instruction will be placed at
     int nextPC() { return static_cast<int>(ops.size()); }
 
     ///! adds an operator to the program (pointing to the data at the current location)
-    int addOp(OpF op) {
+    int addOp(OpF op, BatchOp batchOp = BatchOp()) {
         if (_startedOp) {
             assert(false && "addOp called within another addOp");
         }
         _startedOp = true;
         int pc = static_cast<int>(ops.size());
         ops.push_back(std::make_pair(op, static_cast<int>(opData.size())));
+        batchOps.push_back(batchOp);
         return pc;
     }
 
@@ -93,10 +287,11 @@ class Interpreter {
     }
 
     ///! Adds an operand. Note this should be done after doing the addOp!
-    int addOperand(int param) {
+    int addOperand(int param, OperandKind kind = okUNKNOWN, int dim = 1) {
         assert(_startedOp);
         int ret = static_cast<int>(opData.size());
         opData.push_back(param);
+        operandInfo.push_back({kind, dim});
         return ret;
     }
 
@@ -104,6 +299,7 @@ class Interpreter {
     int allocFP(int n) {
         int ret = static_cast<int>(d.size());
         for (int k = 0; k < n; k++) d.push_back(0);
+        if (n > 0) _fpAllocs.push_back(ret);
         return ret;
     }
 
@@ -111,17 +307,84 @@ class Interpreter {
     int allocPtr() {
         int ret = static_cast<int>(s.size());
         s.push_back(0);
+        _ptrAllocs.push_back(ret);
         return ret;
     }
 
-    /// Evaluate program
-    void eval(VarBlock* varBlock, bool debug = false);
+    /// Evaluate program using frame as working data. The program itself is not modified, so it can be evaluated by
+    /// several threads at once given a frame each.
+    void eval(InterpreterFrame& frame, VarBlock* varBlock, bool debug = false) const;
+    /// Evaluate program with the frame of varBlock if it is thread safe, the interpreter's own frame otherwise
+    void eval(VarBlock* varBlock, bool debug = false) const { eval(frame(varBlock), varBlock, debug); }
+    /// The frame eval(varBlock) works on (results are read from there)
+    InterpreterFrame& frame(VarBlock* varBlock) const;
+    /// Evaluate program for the points [rangeStart,rangeEnd) of varBlock, batchSize points at a time, writing the
+    /// dim values at returnSlot to the output variable. Falls back to eval() per point if the program is not batchable.
+    void evalMultiple(VarBlock* varBlock, int outputVarBlockOffset, int returnSlot, int dim, size_t rangeStart,
+                      size_t rangeEnd) const {
+        evalMultiple(varBlock, {{returnSlot, okFPIN, dim, ChannelFormat()}}, &outputVarBlockOffset, rangeStart, rangeEnd);
+    }
+    /// Evaluate program for the points [rangeStart,rangeEnd) of varBlock in one pass, writing each of the outputs to
+    /// the output variable at the matching offset. A string output (okPTRIN) writes a const char* per point, strings
+    /// built by the program stay valid until the next evalMultiple with frame(varBlock). Ops that read more than their
+    /// operands (host variables without a batch fetch, custom functions) see varBlock->indirectIndex set to the point
+    /// they are evaluated for. Given indices, the range is
+    /// of positions in it: just the points indices lists (each once at most) are evaluated, each batch gathering the
+    /// variables of its points and scattering its outputs to them.
+    void evalMultiple(VarBlock* varBlock, const std::vector<Output>& outputs, const int* outputVarBlockOffsets,
+                      size_t rangeStart, size_t rangeEnd, const uint32_t* indices = nullptr) const;
+
+    /// Working data of a thread evaluating ranges of points with evalMultiple, so that the ranges of one evaluation
+    /// can run on several threads at once, a frame each. The uniform part of the program runs on a frame's first
+    /// range only, so a frame must not be reused once the uniform variables change.
+    struct RangeFrame {
+        RangeFrame();
+        ~RangeFrame();
+        InterpreterFrame scalar;  ///< used by programs that aren't batchable
+        bool started = false;
+        std::unique_ptr<BatchFrame<double>> batch;
+        std::unique_ptr<BatchFrame<float>> floatBatch;
+    };
+    /// evalMultiple working on frame rather than the interpreter's or varBlock's data, and leaving
+    /// varBlock->indirectIndex alone, so that threads can evaluate disjoint ranges of one variable block
+    void evalMultiple(VarBlock* varBlock, RangeFrame& frame, const std::vector<Output>& outputs,
+                      const int* outputVarBlockOffsets, size_t rangeStart, size_t rangeEnd,
+                      const uint32_t* indices = nullptr) const;
     /// Debug by printing program
     void print(int pc = -1) const;
 
     void setPCStart(int pcStart) { _pcStart = pcStart; }
+
+    /// Called once the program is completely built, optimizes it and prepares what evaluation needs (including the
+    /// linked code). returnSlot is read by the caller after evaluation (as described by returnKind, okFPIN or
+    /// okPTRIN, and returnDim); the optimizations preserve it and its possibly moved position is returned. A constant
+    /// program (one whose result has constant lifetime) may be evaluated once here and emptied.
+    int finalize(int returnSlot = -1, OperandKind returnKind = okFPIN, int returnDim = 1, bool constant = false) {
+        std::vector<Output> outputs;
+        if (returnSlot >= 0) outputs.push_back({returnSlot, returnKind, returnDim, ChannelFormat()});
+        finalize(outputs, constant);
+        return returnSlot >= 0 ? outputs[0].slot : returnSlot;
+    }
+    /// Finalizes a program computing several values (e.g. the results of a group of expressions), updating their
+    /// slots
+    void finalize(std::vector<Output>& outputs, bool constant = false);
+    /// Whether evalMultiple can run the program in batches
+    bool batchable() const { return _batchable; }
+    /// Whether variable block data and evalMultiple outputs are float rather than double
+    bool singlePrecision() const { return _singlePrecision; }
 };
 
+template <int d>
+template <class T>
+void Promote<d>::batch(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+    const int W = Interpreter::batchSize;
+    T* in = fp + opData[0] * W;
+    for (int k = 0; k < d; k++) {
+        T* out = fp + (opData[1] + k) * W;
+        forEachLane(lanes, numLanes, [&](int l) { out[l] = in[l]; });
+    }
+}
+
 //! Return the function f encapsulated in class T for the dynamic i converted to a static d.
 template <template <int d> class T, class T_FUNCTYPE = Interpreter::OpF>
 T_FUNCTYPE getTemplatizedOp(int i) {
@@ -164,6 +427,64 @@ T_FUNCTYPE getTemplatizedOp(int i) {
     }
     return 0;
 }
+
+//! The batch kernel of op class Op for lanes of type T, as a kernel selectKernel can compile for each level
+template <class Op, class T>
+struct BatchKernel {
+    static void run(int* opData, T* fp, char** c, const int* lanes, int numLanes) {
+        Op::template batch<T>(opData, fp, c, lanes, numLanes);
+    }
+};
+
+//! Return the batch kernels of op class T for both lane precisions, compiled for the selected instruction set level
+template <class T>
+Interpreter::BatchOp getBatchOp() {
+    return Interpreter::BatchOp(selectKernel<BatchKernel<T, double>, int*, double*, char**, const int*, int>(),
+                                selectKernel<BatchKernel<T, float>, int*, float*, char**, const int*, int>());
+}
+
+//! Return the batch kernels encapsulated in class T for the dynamic i converted to a static d.
+template <template <int d> class T>
+Interpreter::BatchOp getTemplatizedBatchOp(int i) {
+    switch (i) {
+        case 1:
+            return getBatchOp<T<1> >();
+        case 2:
+            return getBatchOp<T<2> >();
+        case 3:
+            return getBatchOp<T<3> >();
+        case 4:
+            return getBatchOp<T<4> >();
+        case 5:
+            return getBatchOp<T<5> >();
+        case 6:
+            return getBatchOp<T<6> >();
+        case 7:
+            return getBatchOp<T<7> >();
+        case 8:
+            return getBatchOp<T<8> >();
+        case 9:
+            return getBatchOp<T<9> >();
+        case 10:
+            return getBatchOp<T<10> >();
+        case 11:
+            return getBatchOp<T<11> >();
+        case 12:
+            return getBatchOp<T<12> >();
+        case 13:
+            return getBatchOp<T<13> >();
+        case 14:
+            return getBatchOp<T<14> >();
+        case 15:
+            return getBatchOp<T<15> >();
+        case 16:
+            return getBatchOp<T<16> >();
+        default:
+            assert(false && "Invalid dynamic parameter (not supported template)");
+            break;
+    }
+    return Interpreter::BatchOp();
+}
 }
 
 #endif
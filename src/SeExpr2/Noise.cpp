@@ -20,6 +20,7 @@
 #include <smmintrin.h>
 #endif
 #include "ExprBuiltins.h"
+#include "CPUDispatch.h"
 
 namespace {
 #include "NoiseTables.h"
@@ -38,6 +39,7 @@ inline double roundSSE(double val)
     return _mm_cvtsd_f64(_mm_round_sd(_mm_set_sd(0.0), _mm_set_sd(val), _MM_FROUND_TO_NEAREST_INT));
 }
 #else
+// the copies of the kernels compiled for sse4.1 and up (see CPUDispatch.h) still get a single instruction floor
 #define floorSSE floor
 #define roundSSE round
 #endif
@@ -151,10 +153,12 @@ namespace SeExpr2 {
 
 //! Computes cellular noise (non-interpolated piecewise constant cell random values)
 template <int d_in, int d_out, class T>
-void CellNoise(const T* in, T* out) {
+void CellNoiseImpl(const T* in, T* out) {
     uint32_t index[d_in];
     int dim = 0;
-    for (int k = 0; k < d_in; k++) index[k] = uint32_t(floorSSE(in[k]));
+    // through a signed integer: converting a negative double straight to unsigned is undefined, and avx-512 has an
+    // instruction for it that gives other results than the wrapping every other level gets
+    for (int k = 0; k < d_in; k++) index[k] = uint32_t(int64_t(floorSSE(in[k])));
     while (1) {
         out[dim] = hashReduce<d_in>(index) * (1.0 / 0xffffffffu);
         if (++dim >= d_out) break;
@@ -164,7 +168,7 @@ void CellNoise(const T* in, T* out) {
 
 //! Noise with d_in dimensional domain, d_out dimensional abcissa
 template <int d_in, int d_out, class T>
-void Noise(const T* in, T* out) {
+void NoiseImpl(const T* in, T* out) {
     T P[d_in];
     for (int i = 0; i < d_in; i++) P[i] = in[i];
 
@@ -178,7 +182,7 @@ void Noise(const T* in, T* out) {
 
 //! Periodic Noise with d_in dimensional domain, d_out dimensional abcissa
 template <int d_in, int d_out, class T>
-void PNoise(const T* in, const int* period, T* out) {
+void PNoiseImpl(const T* in, const int* period, T* out) {
     T P[d_in];
     for (int i = 0; i < d_in; i++) P[i] = in[i];
 
@@ -193,7 +197,7 @@ void PNoise(const T* in, const int* period, T* out) {
 //! Noise with d_in dimensional domain, d_out dimensional abcissa
 //! If turbulence is true then Perlin's turbulence is computed
 template <int d_in, int d_out, bool turbulence, class T>
-void FBM(const T* in, T* out, int octaves, T lacunarity, T gain) {
+void FBMImpl(const T* in, T* out, int octaves, T lacunarity, T gain) {
     T P[d_in];
     for (int i = 0; i < d_in; i++) P[i] = in[i];
 
@@ -202,7 +206,7 @@ void FBM(const T* in, T* out, int octaves, T lacunarity, T gain) {
     int octave = 0;
     while (1) {
         T localResult[d_out];
-        Noise<d_in, d_out>(P, localResult);
+        NoiseImpl<d_in, d_out>(P, localResult);
         if (turbulence)
             for (int k = 0; k < d_out; k++) out[k] += fabs(localResult[k]) * scale;
         else
@@ -216,6 +220,49 @@ void FBM(const T* in, T* out, int octaves, T lacunarity, T gain) {
     }
 }
 
+// The kernels above, compiled for the instruction set level selected at run time
+template <int d_in, int d_out, class T>
+struct CellNoiseKernel {
+    static void run(const T* in, T* out) { CellNoiseImpl<d_in, d_out>(in, out); }
+};
+
+template <int d_in, int d_out, class T>
+struct NoiseKernel {
+    static void run(const T* in, T* out) { NoiseImpl<d_in, d_out>(in, out); }
+};
+
+template <int d_in, int d_out, class T>
+struct PNoiseKernel {
+    static void run(const T* in, const int* period, T* out) { PNoiseImpl<d_in, d_out>(in, period, out); }
+};
+
+template <int d_in, int d_out, bool turbulence, class T>
+struct FBMKernel {
+    static void run(const T* in, T* out, int octaves, T lacunarity, T gain) {
+        FBMImpl<d_in, d_out, turbulence>(in, out, octaves, lacunarity, gain);
+    }
+};
+
+template <int d_in, int d_out, class T>
+void CellNoise(const T* in, T* out) {
+    dispatch<CellNoiseKernel<d_in, d_out, T> >(in, out);
+}
+
+template <int d_in, int d_out, class T>
+void Noise(const T* in, T* out) {
+    dispatch<NoiseKernel<d_in, d_out, T> >(in, out);
+}
+
+template <int d_in, int d_out, class T>
+void PNoise(const T* in, const int* period, T* out) {
+    dispatch<PNoiseKernel<d_in, d_out, T> >(in, period, out);
+}
+
+template <int d_in, int d_out, bool turbulence, class T>
+void FBM(const T* in, T* out, int octaves, T lacunarity, T gain) {
+    dispatch<FBMKernel<d_in, d_out, turbulence, T> >(in, out, octaves, lacunarity, gain);
+}
+
 // Explicit instantiations
 template void CellNoise<3, 1, double>(const double*, double*);
 template void CellNoise<3, 3, double>(const double*, double*);
@@ -232,6 +279,118 @@ template void FBM<3, 3, false, double>(const double*, double*, int, double, doub
 template void FBM<3, 3, true, double>(const double*, double*, int, double, double);
 template void FBM<4, 1, false, double>(const double*, double*, int, double, double);
 template void FBM<4, 3, false, double>(const double*, double*, int, double, double);
+
+// Builtins of the noise family (defined here rather than with the other builtins so that kernels/NoiseKernels.cpp
+// can compile them to bitcode for the LLVM backend together with the templates)
+
+double noise(int n, const Vec3d* args) {
+    if (n < 1) return 0;
+    if (n == 1) {
+        // 1 arg = vector arg
+        double result;
+        double p[3] = {args[0][0], args[0][1], args[0][2]};
+        Noise<3, 1>(p, &result);
+        return .5 * result + .5;
+    }
+    // scalar args
+    if (n > 4) n = 4;
+    double p[4];
+    for (int i = 0; i < n; i++) p[i] = args[i][0];
+    double result;
+    switch (n) {
+        case 1:
+            Noise<1, 1>(p, &result);
+            break;
+        case 2:
+            Noise<2, 1>(p, &result);
+            break;
+        case 3:
+            Noise<3, 1>(p, &result);
+            break;
+        case 4:
+            Noise<4, 1>(p, &result);
+            break;
+        default:
+            result = 0;
+            break;
+    }
+    return .5 * result + .5;
+}
+
+double snoise(const Vec3d& p) {
+    double result;
+    double args[3] = {p[0], p[1], p[2]};
+    Noise<3, 1>(args, &result);
+    return result;
+}
+
+Vec3d vnoise(const Vec3d& p) {
+    Vec3d result;
+    double args[3] = {p[0], p[1], p[2]};
+    Noise<3, 3>(args, &result[0]);
+    return result;
+}
+
+double turbulence(int n, const Vec3d* args) {
+    // args: octaves, lacunarity, gain
+    int octaves = 6;
+    double lacunarity = 2;
+    double gain = 0.5;
+    Vec3d p = 0.0;
+
+    switch (n) {
+        case 4:
+            gain = args[3][0];
+            /* fall through */
+        case 3:
+            lacunarity = args[2][0];
+            /* fall through */
+        case 2:
+            octaves = int(clamp(args[1][0], 1, 8));
+            /* fall through */
+        case 1:
+            p = args[0];
+    }
+
+    double result = 0;
+    double P[3] = {p[0], p[1], p[2]};
+    FBM<3, 1, true>(P, &result, octaves, lacunarity, gain);
+    return .5 * result + .5;
+}
+
+double fbm(int n, const Vec3d* args) {
+    // args: octaves, lacunarity, gain
+    int octaves = 6;
+    double lacunarity = 2;
+    double gain = 0.5;
+    Vec3d p = 0.0;
+
+    switch (n) {
+        case 4:
+            gain = args[3][0];
+            /* fall through */
+        case 3:
+            lacunarity = args[2][0];
+            /* fall through */
+        case 2:
+            octaves = int(clamp(args[1][0], 1, 8));
+            /* fall through */
+        case 1:
+            p = args[0];
+    }
+
+    double result = 0.0;
+    double P[3] = {p[0], p[1], p[2]};
+    FBM<3, 1, false>(P, &result, octaves, lacunarity, gain);
+    return .5 * result + .5;
+}
+
+double cellnoise(const Vec3d& p) {
+    double result;
+    double args[3] = {p[0], p[1], p[2]};
+    CellNoise<3, 1>(args, &result);
+    return result;
+}
 }
 
 #ifdef MAINTEST
@@ -0,0 +1,56 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#include "StringArena.h"
+#include "Mutex.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+namespace SeExpr2 {
+
+constexpr size_t StringArena::blockSize;
+
+char* StringArena::allocate(size_t size) {
+    // move on to the next block that has room (blocks skipped after a release are reused by the next reset)
+    while (_block < _blocks.size() && _used + size > _blocks[_block].size) {
+        _block++;
+        _used = 0;
+    }
+    if (_block == _blocks.size()) {
+        size_t blockBytes = std::max(size, blockSize);
+        _blocks.push_back({std::unique_ptr<char[]>(new char[blockBytes]), blockBytes});
+    }
+    char* result = _blocks[_block].data.get() + _used;
+    _used += size;
+    return result;
+}
+
+char* StringArena::concat(const char* a, const char* b) {
+    size_t len1 = strlen(a), len2 = strlen(b);
+    char* result = allocate(len1 + len2 + 1);
+    memcpy(result, a, len1);
+    memcpy(result + len1, b, len2 + 1);
+    return result;
+}
+
+const char* internString(const std::string& str) {
+    static SeExprInternal2::Mutex mutex;
+    static std::unordered_set<std::string> strings;
+    SeExprInternal2::AutoMutex locker(mutex);
+    return strings.insert(str).first->c_str();
+}
+}
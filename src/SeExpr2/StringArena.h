@@ -0,0 +1,66 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#ifndef StringArena_h
+#define StringArena_h
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SeExpr2 {
+
+/// Storage for the strings built while evaluating (e.g. by concatenation). Strings are carved out of a few large
+/// blocks that are kept when the arena is reset, so repeated evaluations don't touch the heap. A string stays valid
+/// until the arena is reset (or released to a mark taken before it was allocated).
+class StringArena {
+  public:
+    /// Position in the arena, see release()
+    struct Mark {
+        size_t block;
+        size_t used;
+    };
+
+    /// Uninitialized storage for size chars
+    char* allocate(size_t size);
+    /// New string holding a followed by b
+    char* concat(const char* a, const char* b);
+
+    Mark mark() const { return {_block, _used}; }
+    /// Frees everything allocated since mark was taken
+    void release(const Mark& mark) {
+        _block = mark.block;
+        _used = mark.used;
+    }
+    void reset() { release({0, 0}); }
+
+  private:
+    static constexpr size_t blockSize = 4096;
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+    std::vector<Block> _blocks;
+    size_t _block = 0, _used = 0;
+};
+
+/// Returns the unique copy of str. Equal strings are interned at the same address, so interned strings can be
+/// compared by pointer first. Interned strings live as long as the process.
+const char* internString(const std::string& str);
+}
+
+#endif
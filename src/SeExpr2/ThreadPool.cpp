@@ -0,0 +1,203 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+
+#include "ThreadPool.h"
+
+namespace SeExpr2 {
+
+namespace {
+//! Whether the thread is one of a pool's
+thread_local bool poolThread = false;
+}
+
+//! A loop in progress. Share w is the part of the range worker w works through, from the front; thieves take chunks
+//! off the back.
+struct ThreadPool::Loop {
+    struct Share {
+        std::mutex mutex;
+        size_t start = 0, end = 0;
+    };
+    const ChunkFunction* f;
+    size_t grain;
+    std::unique_ptr<Share[]> shares;
+    int numShares;
+    /// Which pool threads joined (guarded by the pool's mutex)
+    std::vector<bool> joined;
+    /// Threads working on the loop and the first exception thrown
+    std::mutex mutex;
+    std::condition_variable done;
+    int active = 0;
+    std::exception_ptr error;
+};
+
+ThreadPool::ThreadPool(int numThreads) : _numThreads(std::max(numThreads, 1)) {}
+
+ThreadPool::~ThreadPool() { stopThreads(); }
+
+ThreadPool& ThreadPool::global() {
+    static ThreadPool pool([] {
+        const char* threads = getenv("SE_EXPR_THREADS");
+        int n = threads ? atoi(threads) : static_cast<int>(std::thread::hardware_concurrency());
+        return n > 0 ? n : 1;
+    }());
+    return pool;
+}
+
+int ThreadPool::numThreads() const { return _numThreads; }
+
+void ThreadPool::setNumThreads(int numThreads) {
+    stopThreads();
+    _numThreads = std::max(numThreads, 1);
+}
+
+void ThreadPool::stopThreads() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+    for (std::thread& thread : _threads) thread.join();
+    _threads.clear();
+    _stopping = false;
+}
+
+void ThreadPool::parallelFor(size_t rangeStart, size_t rangeEnd, size_t grain, const ChunkFunction& f) {
+    grain = std::max(grain, size_t(1));
+    if (rangeStart >= rangeEnd) return;
+    size_t numChunks = (rangeEnd - rangeStart + grain - 1) / grain;
+    if (poolThread || _numThreads <= 1 || numChunks <= 1) {
+        for (size_t start = rangeStart; start < rangeEnd; start += grain) f(0, start, std::min(start + grain, rangeEnd));
+        return;
+    }
+
+    // every thread starts with an even share of the chunks
+    Loop loop;
+    loop.f = &f;
+    loop.grain = grain;
+    loop.numShares = static_cast<int>(std::min(numChunks, static_cast<size_t>(_numThreads)));
+    loop.shares.reset(new Loop::Share[loop.numShares]);
+    loop.joined.assign(_numThreads, false);
+    for (int w = 0; w < loop.numShares; w++) {
+        loop.shares[w].start = rangeStart + numChunks * w / loop.numShares * grain;
+        loop.shares[w].end = std::min(rangeStart + numChunks * (w + 1) / loop.numShares * grain, rangeEnd);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (int w = static_cast<int>(_threads.size()) + 1; w < _numThreads; w++)
+            _threads.emplace_back(&ThreadPool::threadMain, this, w);
+        loop.joined[0] = true;
+        loop.active = 1;
+        _loops.push_back(&loop);
+    }
+    _wake.notify_all();
+
+    work(loop, 0);
+
+    // no thread joins once the loop is off the list, wait for the ones still running chunks
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _loops.remove(&loop);
+    }
+    std::unique_lock<std::mutex> lock(loop.mutex);
+    loop.active--;
+    loop.done.wait(lock, [&] { return loop.active == 0; });
+    if (loop.error) std::rethrow_exception(loop.error);
+}
+
+void ThreadPool::work(Loop& loop, int worker) {
+    // a thread that joins a loop with fewer chunks than threads has no share, it only steals
+    int own = worker < loop.numShares ? worker : -1;
+    Loop::Share stolen;
+    Loop::Share& share = own >= 0 ? loop.shares[own] : stolen;
+    for (;;) {
+        size_t start = 0, end = 0;
+        {
+            std::lock_guard<std::mutex> lock(share.mutex);
+            if (share.start < share.end) {
+                start = share.start;
+                end = std::min(start + loop.grain, share.end);
+                share.start = end;
+            }
+        }
+        if (start == end) {
+            // steal the later half of the chunks of the largest share left
+            int victim = -1;
+            size_t most = 0;
+            for (int w = 0; w < loop.numShares; w++) {
+                std::lock_guard<std::mutex> lock(loop.shares[w].mutex);
+                size_t left = loop.shares[w].end - loop.shares[w].start;
+                if (left > most) most = left, victim = w;
+            }
+            if (victim < 0) return;
+            Loop::Share& from = loop.shares[victim];
+            size_t stealStart, stealEnd;
+            {
+                std::lock_guard<std::mutex> lock(from.mutex);
+                if (from.start >= from.end) continue;
+                size_t chunks = (from.end - from.start + loop.grain - 1) / loop.grain;
+                stealStart = from.start + chunks / 2 * loop.grain;
+                stealEnd = from.end;
+                from.end = stealStart;
+            }
+            std::lock_guard<std::mutex> lock(share.mutex);
+            share.start = stealStart;
+            share.end = stealEnd;
+            continue;
+        }
+        try {
+            (*loop.f)(worker, start, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(loop.mutex);
+            if (!loop.error) loop.error = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::threadMain(int worker) {
+    poolThread = true;
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;) {
+        Loop* loop = nullptr;
+        for (Loop* candidate : _loops)
+            if (!candidate->joined[worker]) {
+                loop = candidate;
+                break;
+            }
+        if (!loop) {
+            if (_stopping) return;
+            _wake.wait(lock);
+            continue;
+        }
+        loop->joined[worker] = true;
+        {
+            std::lock_guard<std::mutex> loopLock(loop->mutex);
+            loop->active++;
+        }
+        lock.unlock();
+        work(*loop, worker);
+        {
+            std::lock_guard<std::mutex> loopLock(loop->mutex);
+            if (--loop->active == 0) loop->done.notify_all();
+        }
+        lock.lock();
+    }
+}
+}
@@ -0,0 +1,75 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SeExpr2 {
+
+/// Threads running parallel loops over ranges of points (see Expression::evalMultipleParallel). A loop's range is
+/// split between its threads up front, each thread works through its share a chunk at a time and, once it runs out,
+/// steals the later half of the largest share left. The thread starting a loop takes part in it and the call returns
+/// when the whole range is done. Several threads can run loops at once, they share the pool's threads.
+class ThreadPool {
+  public:
+    /// Calls f(worker,chunkStart,chunkEnd) for chunks of [rangeStart,rangeEnd) on up to numThreads() threads.
+    /// Chunks are grain points long (but for the last one) and start at a multiple of grain from rangeStart. worker
+    /// is in [0,numThreads()) and unique among the calls of the loop running at once, to index per thread data. A loop
+    /// started by a thread of the pool (from within another loop) runs on the calling thread alone. The first
+    /// exception f throws is rethrown once the loop is done.
+    typedef std::function<void(int worker, size_t chunkStart, size_t chunkEnd)> ChunkFunction;
+    void parallelFor(size_t rangeStart, size_t rangeEnd, size_t grain, const ChunkFunction& f);
+
+    /// Number of threads loops run on, the calling one included
+    int numThreads() const;
+    /// Sets it (1 runs loops on the calling thread only). Must not be called while loops are running.
+    void setNumThreads(int numThreads);
+
+    /// The pool evaluation uses, with SE_EXPR_THREADS threads (the number of hardware threads by default). Its threads
+    /// are only started by the first loop.
+    static ThreadPool& global();
+
+    explicit ThreadPool(int numThreads);
+    ~ThreadPool();
+
+  private:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    struct Loop;
+    /// Runs chunks of loop as its worker-th thread until none are left
+    static void work(Loop& loop, int worker);
+    void threadMain(int worker);
+    void stopThreads();
+
+    int _numThreads;
+    std::vector<std::thread> _threads;
+    /// Guards the list of loops in progress, the threads wait on _wake for new ones
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::list<Loop*> _loops;
+    bool _stopping = false;
+};
+}
+
+#endif
@@ -17,10 +17,13 @@
 #ifndef VarBlock_h
 #define VarBlock_h
 
+#include "Channel.h"
 #include "Expression.h"
 #include "ExprType.h"
 #include "Vec.h"
 
+#include <memory>
+
 namespace SeExpr2 {
 
 class ExprNode;
@@ -28,6 +31,7 @@ class ExprVarNode;
 class ExprFunc;
 
 class VarBlockCreator;
+struct InterpreterFrames;
 
 /// A thread local evaluation context. Just allocate and fill in with data.
 class VarBlock {
@@ -41,8 +45,7 @@ class VarBlock {
     /// Move semantics is the only allowed way to change the structure
     VarBlock(VarBlock&& other) {
         threadSafe = other.threadSafe;
-        d = std::move(other.d);
-        s = std::move(other.s);
+        frames = std::move(other.frames);
         _dataPtrs = std::move(other._dataPtrs);
         indirectIndex = other.indirectIndex;
     }
@@ -55,26 +58,29 @@ class VarBlock {
 
     /// Get a reference to the data block pointer which can be modified
     double*& Pointer(uint32_t variableOffset) { return reinterpret_cast<double*&>(_dataPtrs[variableOffset]); }
+    /// Likewise for string variables, an array of a string per point (one if uniform), which is also what
+    /// evalMultiple fills in for string expressions
     char**& CharPointer(uint32_t variableOffset) { return reinterpret_cast<char**&>(_dataPtrs[variableOffset]); }
+    /// Likewise for the float data of expressions evaluated with Expression::UseFloat
+    float*& FloatPointer(uint32_t variableOffset) { return reinterpret_cast<float*&>(_dataPtrs[variableOffset]); }
 
     /// indirect index to add to pointer based data
     // i.e.  _dataPtrs[someAttributeOffset][indirectIndex]
     int indirectIndex;
 
-    /// if true, interpreter's data will be copied to this instance before evaluation.
+    /// if true, evaluation works on interpreter frames owned by this instance instead of the interpreter's own.
     bool threadSafe;
 
-    /// copy of Interpreter's double data
-    std::vector<double> d;
-
-    /// copy of Interpreter's str data
-    std::vector<char*> s;
+    /// Interpreter working data, a frame per program recently evaluated with this block (see Interpreter::frame)
+    std::shared_ptr<InterpreterFrames> frames;
 
     /// Raw data of the data block pointer (used by compiler)
     char** data() { return _dataPtrs.data(); }
+    /// Number of variables in the block (the size of data())
+    int numVariables() const { return static_cast<int>(_dataPtrs.size()); }
 
   private:
-    /// This stores double* or char** ptrs to variables
+    /// This stores double* (or float*) or char** ptrs to variables
     std::vector<char*> _dataPtrs;
 };
 
@@ -87,34 +93,63 @@ class VarBlockCreator {
     class Ref : public ExprVarRef {
         uint32_t _offset;
         uint32_t _stride;
+        ChannelFormat _format;
 
       public:
         uint32_t offset() const { return _offset; }
+        /// Elements between points (of the element type of format())
         uint32_t stride() const { return _stride; }
-        Ref(const ExprType& type, uint32_t offset, uint32_t stride)
-            : ExprVarRef(type), _offset(offset), _stride(stride) {}
+        const ChannelFormat& format() const { return _format; }
+        Ref(const ExprType& type, uint32_t offset, uint32_t stride, ChannelFormat format = ChannelFormat())
+            : ExprVarRef(type), _offset(offset), _stride(stride), _format(format) {}
         void eval(double*) override { assert(false); }
         void eval(const char**) override { assert(false); }
     };
 
     /// Register a variable and return a handle
     int registerVariable(const std::string& name, const ExprType type) {
+        return registerVariable(name, type, ChannelType::Native);
+    }
+
+    /// Register a variable whose data (or output, for a variable evalMultiple writes to) is made of elements of
+    /// elementType, converted on the fly, with points byteStride bytes apart (0 if packed). The strides and the data
+    /// pointers of Float64, Float32 and Half variables must keep their elements aligned.
+    int registerVariable(const std::string& name, const ExprType type, ChannelType elementType,
+                         uint32_t byteStride = 0) {
         if (_vars.find(name) != _vars.end()) {
             throw std::runtime_error("Already registered a variable named " + name);
         } else {
+            ChannelFormat format = {elementType, 0};
+            uint32_t stride = type.dim();
+            if (elementType != ChannelType::Native) {
+                uint32_t elementSize = static_cast<uint32_t>(channelTypeSize(elementType));
+                if (!type.isFP()) throw std::runtime_error("Only FP variables can have an element type: " + name);
+                format.byteStride = byteStride ? byteStride : type.dim() * elementSize;
+                if (format.byteStride % elementSize || format.byteStride < type.dim() * elementSize)
+                    throw std::runtime_error("Stride of " + name + " doesn't fit aligned points");
+                stride = format.byteStride / elementSize;
+            } else if (byteStride)
+                throw std::runtime_error("Variable " + name + " needs an element type to have a stride");
             int offset = _nextOffset;
             _nextOffset += 1;
-            _vars.insert(std::make_pair(name, Ref(type, offset, type.dim())));
+            _vars.insert(std::make_pair(name, Ref(type, offset, stride, format)));
+            _formats.push_back(format);
             return offset;
         }
     }
 
+    /// Layout of the data of the variable at variableOffset
+    ChannelFormat format(int variableOffset) const {
+        return variableOffset >= 0 && variableOffset < static_cast<int>(_formats.size()) ? _formats[variableOffset]
+                                                                                         : ChannelFormat();
+    }
+
     /// Get an evaluation handle (one needed per thread)
     /// \param makeThreadSafe
-    ///     If true, right before evaluating the expression, all data used
-    ///     by the interpreter will be copied to the var block, to make the
-    ///     evaluation thread safe (assuming there's one var block instead
-    ///     per thread)
+    ///     If true, the interpreter evaluates with working data held by
+    ///     the var block (copied from the expression once, on its first
+    ///     evaluation with this block) to make the evaluation thread safe
+    ///     (assuming there's one var block instead per thread)
     ///     If false or not specified, the old behavior occurs (var block
     ///     will only hold variables sources and optionally output data,
     ///     and the interpreter will work on its internal data)
@@ -122,6 +157,15 @@ class VarBlockCreator {
         return VarBlock(_nextOffset, makeThreadSafe);
     }
 
+    /// Number of values a point has in the registered varying FP variables, which evaluating a range of points
+    /// streams through
+    int varyingDim() const {
+        int dim = 0;
+        for (const auto& var : _vars)
+            if (var.second.type().isFP() && var.second.type().isLifetimeVarying()) dim += var.second.type().dim();
+        return dim;
+    }
+
     /// Resolve the variable using anything in the data block (call from resolveVar in Expr subclass)
     ExprVarRef* resolveVar(const std::string& name) const {
         auto it = _vars.find(name);
@@ -132,6 +176,7 @@ class VarBlockCreator {
   private:
     int _nextOffset = 0;
     std::map<std::string, Ref> _vars;
+    std::vector<ChannelFormat> _formats;
 };
 
 }  // namespace
@@ -0,0 +1,32 @@
+# Copyright Disney Enterprises, Inc.  All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License
+# and the following modification to it: Section 6 Trademarks.
+# deleted and replaced with:
+#
+# 6. Trademarks. This License does not grant permission to use the
+# trade names, trademarks, service marks, or product names of the
+# Licensor and its affiliates, except as required for reproducing
+# the content of the NOTICE file.
+#
+# You may obtain a copy of the License at
+# http://www.apache.org/licenses/LICENSE-2.0
+
+# Writes OUTPUT defining the byte array NAME (and NAME##Size) with the contents of INPUT, or an empty one when no
+# INPUT is given. Run with cmake -DNAME=... -DINPUT=... -DOUTPUT=... -P EmbedBitcode.cmake
+set(bytes "")
+set(size 0)
+if (INPUT)
+    file(READ ${INPUT} hex HEX)
+    string(LENGTH "${hex}" length)
+    math(EXPR size "${length} / 2")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${hex}")
+endif()
+file(WRITE ${OUTPUT}
+    "// Generated by EmbedBitcode.cmake\n"
+    "#include <cstddef>\n"
+    "extern \"C\" {\n"
+    "extern const unsigned char ${NAME}[] = {${bytes}0};\n"
+    "extern const size_t ${NAME}Size = ${size};\n"
+    "}\n")
@@ -0,0 +1,49 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Not part of the library: compiled to bitcode when building the LLVM backend and embedded in it. The JIT links the
+// functions below into expression modules in place of calls to the noise builtins, so they get inlined and optimized
+// with the expression. Their names and signatures are the ones generated code calls standard functions with (see
+// standardFunctionSymbol and getSeExprFuncStandardLLVMType); vector arguments are 3 doubles each.
+
+// the JIT compiles these for the host cpu itself, so they call the kernels directly rather than dispatching
+#define SEEXPR_NO_MULTIVERSION
+#include "../Noise.cpp"
+
+using namespace SeExpr2;
+
+namespace {
+inline const Vec3d* vectors(const double* args) { return reinterpret_cast<const Vec3d*>(args); }
+}
+
+extern "C" {
+
+double SeExpr2Std_noise(int n, const double* args) { return noise(n, vectors(args)); }
+
+double SeExpr2Std_snoise(const double* p) { return snoise(*vectors(p)); }
+
+void SeExpr2Std_vnoise(double* result, const double* p) {
+    Vec3d v = vnoise(*vectors(p));
+    for (int k = 0; k < 3; k++) result[k] = v[k];
+}
+
+double SeExpr2Std_turbulence(int n, const double* args) { return turbulence(n, vectors(args)); }
+
+double SeExpr2Std_fbm(int n, const double* args) { return fbm(n, vectors(args)); }
+
+double SeExpr2Std_cellnoise(const double* p) { return cellnoise(*vectors(p)); }
+}
@@ -0,0 +1,98 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Times the interpreter's batched evalMultiple against evaluating every point with evalFP, and fails if batches are
+// slower for any of the expressions (mostly built from builtin function calls, which have batch kernels). Pass a
+// number of points to time more or fewer than the default.
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/VarBlock.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const int repeats = 5;
+
+//! The best of repeats runs of f, in seconds
+template <class F>
+double bestTime(F f) {
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+}
+
+int main(int argc, char* argv[]) {
+    size_t numPoints = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+
+    VarBlockCreator creator;
+    int offP = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int offU = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int offOut = creator.registerVariable("out", ExprType().FP(3).Varying());
+
+    std::vector<double> P(numPoints * 3), u(numPoints), out(numPoints * 3);
+    for (size_t i = 0; i < numPoints; i++) {
+        u[i] = double(i % 1000) / 1000;
+        for (int k = 0; k < 3; k++) P[3 * i + k] = double(i % 997) * .01 + k;
+    }
+    VarBlock block = creator.create();
+    block.Pointer(offP) = P.data();
+    block.Pointer(offU) = u.data();
+    block.Pointer(offOut) = out.data();
+
+    const char* exprs[] = {"sin(u)*cos(u) + clamp(u, .2, .6) + P",
+                           "noise(P*3) + P*u",
+                           "fit(u, 0, 1, 2, 3)*P + pow(u, 2)",
+                           "cross(P, [0, 1, 0]) + length(P)*u",
+                           "u > .5 ? sin(P) : cos(P)*u"};
+
+    bool good = true;
+    for (const char* str : exprs) {
+        Expression e(str, TypeVec(3), Expression::UseInterpreter);
+        e.setVarBlockCreator(&creator);
+        if (!e.isValid()) {
+            std::cerr << "Expr '" << str << "' invalid because\n" << e.parseError() << std::endl;
+            good = false;
+            continue;
+        }
+        double perPoint = bestTime([&]() {
+            for (size_t i = 0; i < numPoints; i++) {
+                block.indirectIndex = static_cast<int>(i);
+                const double* f = e.evalFP(&block);
+                std::copy(f, f + 3, &out[3 * i]);
+            }
+        });
+        double batched = bestTime([&]() { e.evalMultiple(&block, offOut, 0, numPoints); });
+        std::cout << "'" << str << "': " << perPoint << "s per point, " << batched << "s batched" << std::endl;
+        if (batched > perPoint) {
+            std::cerr << "Expr '" << str << "' is slower batched" << std::endl;
+            good = false;
+        }
+    }
+    return good ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that the kernels compiled for every instruction set level the host supports compute exactly what the
+// baseline ones do, for the noise family, voronoi, curves and the interpreter's batch ops
+
+#include <SeExpr2/CPUDispatch.h>
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/VarBlock.h>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const int numPoints = 37;
+
+const char* exprs[] = {"noise(P*3.7)",
+                       "snoise(P*2.1) + noise(u*5, P[1]*3) + noise(u, P[0], P[2], u*2)",
+                       "vnoise(P*1.3) + cnoise(P)",
+                       "fbm(P*2, 6, 2.1, .6) + turbulence(P*3, 4)",
+                       "vfbm(P, 5) + vturbulence(P*2, 3)",
+                       "fbm4(P, u*3) + vfbm4(P*2, u)",
+                       "cellnoise(P*4) + ccellnoise(P*3)",
+                       "pnoise(P*5, [2, 3, 4])",
+                       "voronoi(P*3) + voronoi(P*2, 2, .7) + voronoi(P, 3) + voronoi(P*4, 4) + voronoi(P*5, 5, .3)",
+                       "voronoi(P*2, 2, .5, .4)",
+                       "curve(u, 0, 0, 4, .3, 1, 4, .6, .2, 1, 1, .5, 3)",
+                       "ccurve(u, 0, [1, 0, 0], 4, .5, [0, 1, .5], 4, 1, [0, 0, 1], 2)",
+                       "P*u + [1, 2, 3]/(u + 1) - P^2",
+                       "u > .5 ? P*sin(u) : -P"};
+const int numExprs = sizeof(exprs) / sizeof(exprs[0]);
+
+}
+
+int main() {
+    bool good = true;
+    ISALevel host = hostISALevel();
+    std::cout << "host level " << isaLevelName(host) << ", llvm target '" << Expression::llvmTarget() << "'"
+              << std::endl;
+
+    // levels are capped at the host's
+    setISALevel(ISAAVX512);
+    if (selectedISALevel() != host) {
+        std::cerr << "selected level " << isaLevelName(selectedISALevel()) << " not the host's" << std::endl;
+        good = false;
+    }
+
+    VarBlockCreator creator;
+    int offP = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int offU = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int offOut = creator.registerVariable("out", ExprType().FP(3).Varying());
+    std::vector<double> P(numPoints * 3), u(numPoints);
+    for (int i = 0; i < numPoints; i++) {
+        u[i] = double(i) / (numPoints - 1);
+        P[3 * i] = i * 0.37 - 3;
+        P[3 * i + 1] = 1 - u[i] * 2.3;
+        P[3 * i + 2] = u[i] * u[i] * 7;
+    }
+
+    std::vector<std::vector<double>> baseline(numExprs);
+    for (int level = ISABaseline; level <= host; level++) {
+        setISALevel(ISALevel(level));
+        for (int e = 0; e < numExprs; e++) {
+            // the interpreter program picks its batch ops when it's built, so each level builds its own
+            Expression expr(exprs[e], TypeVec(3), Expression::UseInterpreter);
+            expr.setVarBlockCreator(&creator);
+            if (!expr.isValid()) {
+                std::cerr << "Expr '" << exprs[e] << "' invalid: " << expr.parseError() << std::endl;
+                good = false;
+                continue;
+            }
+            std::vector<double> out(numPoints * 3, -1.);
+            VarBlock block = creator.create();
+            block.Pointer(offP) = P.data();
+            block.Pointer(offU) = u.data();
+            block.Pointer(offOut) = out.data();
+            expr.evalMultiple(&block, offOut, 0, numPoints);
+            if (level == ISABaseline)
+                baseline[e] = out;
+            else if (memcmp(out.data(), baseline[e].data(), out.size() * sizeof(double)))
+                for (size_t k = 0; k < out.size(); k++)
+                    if (out[k] != baseline[e][k]) {
+                        std::cerr << "Expr '" << exprs[e] << "' " << isaLevelName(ISALevel(level)) << " index " << k
+                                  << " " << out[k] << " != baseline " << baseline[e][k] << std::endl;
+                        good = false;
+                        break;
+                    }
+        }
+    }
+    return good ? 0 : 1;
+}
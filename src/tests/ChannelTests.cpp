@@ -0,0 +1,226 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks the half conversions, and that expressions reading and writing typed, strided variables compute what they
+// do on the same values in native variables, with both evaluators, in both precisions
+
+#include <SeExpr2/Channel.h>
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExprNode.h>
+#include <SeExpr2/VarBlock.h>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const size_t numPoints = 1001;
+
+const char* exprs[] = {"P*u + C", "u > .5 ? C*2 - P : P*s", "def FLOAT[3] f(FLOAT[3] p) { p*u + s } f(C) - f(P)",
+                       "noise(P*3)*C + [u, -u, 2]"};
+const int numExprs = sizeof(exprs) / sizeof(exprs[0]);
+
+// a point of host geometry: a float position and some other attribute
+struct Vertex {
+    float P[3];
+    int id;
+};
+
+bool testHalf() {
+    bool good = true;
+    for (uint32_t bits = 0; bits < 0x10000; bits++) {
+        float f = halfToFloat(static_cast<uint16_t>(bits));
+        uint16_t back = floatToHalf(f);
+        if (std::isnan(f) ? !std::isnan(halfToFloat(back)) : back != bits) {
+            std::cerr << "half " << std::hex << bits << " -> " << f << " -> " << back << std::dec << std::endl;
+            good = false;
+        }
+    }
+    struct {
+        float value;
+        uint16_t bits;
+    } cases[] = {{1.f, 0x3c00},      {65504.f, 0x7bff},   {65519.f, 0x7bff},   {65520.f, 0x7c00},
+                 {1e9f, 0x7c00},     {-2.f, 0xc000},      {5.9604645e-8f, 1},  {2.9802322e-8f, 0},
+                 {2.9802326e-8f, 1}, {1.00048828f, 0x3c00}, {1.00146484f, 0x3c02}};
+    for (const auto& c : cases)
+        if (floatToHalf(c.value) != c.bits) {
+            std::cerr << "half of " << c.value << " is " << std::hex << floatToHalf(c.value) << " not " << c.bits
+                      << std::dec << std::endl;
+            good = false;
+        }
+    return good;
+}
+
+bool testRegistration() {
+    bool good = true;
+    VarBlockCreator creator;
+    struct {
+        ChannelType type;
+        uint32_t byteStride;
+    } bad[] = {{ChannelType::Float32, 6}, {ChannelType::Half, 5}, {ChannelType::Float64, 16}, {ChannelType::Native, 8}};
+    for (const auto& b : bad) {
+        bool thrown = false;
+        try {
+            creator.registerVariable("v" + std::to_string(&b - bad), ExprType().FP(3).Varying(), b.type, b.byteStride);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        if (!thrown) {
+            std::cerr << "stride " << b.byteStride << " accepted" << std::endl;
+            good = false;
+        }
+    }
+    int offset = creator.registerVariable("rgba", ExprType().FP(3).Varying(), ChannelType::UInt8, 4);
+    if (creator.format(offset).byteStride != 4 || creator.format(offset).type != ChannelType::UInt8) good = false;
+    offset = creator.registerVariable("n", ExprType().FP(3).Varying(), ChannelType::Half);
+    if (creator.format(offset).byteStride != 6) good = false;
+    return good;
+}
+
+}
+
+int main() {
+    bool good = testHalf() && testRegistration();
+
+    // the host buffers: float positions in vertices, half u, 8 bit rgba colors and a uniform float64 s
+    std::vector<Vertex> vertices(numPoints);
+    std::vector<Half> u(numPoints);
+    std::vector<uint8_t> colors(numPoints * 4);
+    double s = .375;
+    for (size_t i = 0; i < numPoints; i++) {
+        vertices[i] = {{float(i) * .01f, 1.f - float(i % 7) * .1f, float(i % 13)}, int(i)};
+        u[i].bits = floatToHalf(float(i % 100) / 99);
+        for (int k = 0; k < 4; k++) colors[4 * i + k] = uint8_t((i * 37 + k * 91) % 256);
+    }
+
+    VarBlockCreator typed;
+    int tP = typed.registerVariable("P", ExprType().FP(3).Varying(), ChannelType::Float32, sizeof(Vertex));
+    int tU = typed.registerVariable("u", ExprType().FP(1).Varying(), ChannelType::Half);
+    int tC = typed.registerVariable("C", ExprType().FP(3).Varying(), ChannelType::UInt8, 4);
+    int tS = typed.registerVariable("s", ExprType().FP(1).Uniform(), ChannelType::Float64);
+    int tRGBA = typed.registerVariable("rgba", ExprType().FP(3).Varying(), ChannelType::UInt8, 4);
+    int tHalf = typed.registerVariable("h", ExprType().FP(3).Varying(), ChannelType::Half, 8);
+
+    VarBlockCreator native;
+    int nP = native.registerVariable("P", ExprType().FP(3).Varying());
+    int nU = native.registerVariable("u", ExprType().FP(1).Varying());
+    int nC = native.registerVariable("C", ExprType().FP(3).Varying());
+    int nS = native.registerVariable("s", ExprType().FP(1).Uniform());
+    int nOut = native.registerVariable("out", ExprType().FP(3).Varying());
+
+    // the same values, converted up front
+    std::vector<double> P(numPoints * 3), U(numPoints), C(numPoints * 3);
+    for (size_t i = 0; i < numPoints; i++) {
+        for (int k = 0; k < 3; k++) {
+            P[3 * i + k] = channelValue(vertices[i].P[k]);
+            C[3 * i + k] = channelValue(colors[4 * i + k]);
+        }
+        U[i] = channelValue(u[i]);
+    }
+    std::vector<float> floatP(P.begin(), P.end()), floatU(U.begin(), U.end()), floatC(C.begin(), C.end());
+    float floatS = float(s);
+
+    std::vector<Expression::EvaluationStrategy> strategies = {Expression::UseInterpreter};
+#ifdef SEEXPR_ENABLE_LLVM
+    strategies.push_back(Expression::UseLLVM);
+#endif
+    for (Expression::EvaluationStrategy strategy : strategies)
+        for (int single = 0; single < 2; single++)
+            for (int e = 0; e < numExprs; e++) {
+                Expression typedExpr(exprs[e], TypeVec(3), strategy), nativeExpr(exprs[e], TypeVec(3), strategy);
+                typedExpr.setVarBlockCreator(&typed);
+                nativeExpr.setVarBlockCreator(&native);
+                for (Expression* expr : {&typedExpr, &nativeExpr})
+                    expr->setEvaluationPrecision(single ? Expression::UseFloat : Expression::UseDouble);
+                if (!typedExpr.isValid() || !nativeExpr.isValid()) {
+                    std::cerr << "Expr '" << exprs[e] << "' invalid: " << typedExpr.parseError() << std::endl;
+                    good = false;
+                    continue;
+                }
+
+                VarBlock nativeBlock = native.create();
+                std::vector<double> out(numPoints * 3);
+                std::vector<float> floatOut(numPoints * 3);
+                if (single) {
+                    nativeBlock.FloatPointer(nP) = floatP.data();
+                    nativeBlock.FloatPointer(nU) = floatU.data();
+                    nativeBlock.FloatPointer(nC) = floatC.data();
+                    nativeBlock.FloatPointer(nS) = &floatS;
+                    nativeBlock.FloatPointer(nOut) = floatOut.data();
+                } else {
+                    nativeBlock.Pointer(nP) = P.data();
+                    nativeBlock.Pointer(nU) = U.data();
+                    nativeBlock.Pointer(nC) = C.data();
+                    nativeBlock.Pointer(nS) = &s;
+                    nativeBlock.Pointer(nOut) = out.data();
+                }
+                nativeExpr.evalMultiple(&nativeBlock, nOut, 0, numPoints);
+
+                // outputs into 8 bit rgba (alpha untouched) and half padded to 4 components
+                for (int parallel = 0; parallel < 2; parallel++) {
+                    VarBlock block = typed.create();
+                    std::vector<uint8_t> rgba(numPoints * 4, 7);
+                    std::vector<Half> halves(numPoints * 4, Half{0x1234});
+                    block.CharPointer(tP) = reinterpret_cast<char**>(&vertices[0].P[0]);
+                    block.CharPointer(tU) = reinterpret_cast<char**>(u.data());
+                    block.CharPointer(tC) = reinterpret_cast<char**>(colors.data());
+                    block.Pointer(tS) = &s;
+                    block.CharPointer(tRGBA) = reinterpret_cast<char**>(rgba.data());
+                    block.CharPointer(tHalf) = reinterpret_cast<char**>(halves.data());
+                    if (parallel) {
+                        typedExpr.evalMultipleParallel(&block, tRGBA, 0, numPoints);
+                        typedExpr.evalMultipleParallel(&block, tHalf, 0, numPoints);
+                    } else {
+                        typedExpr.evalMultiple(&block, tRGBA, 0, numPoints);
+                        typedExpr.evalMultiple(&block, tHalf, 0, numPoints);
+                    }
+
+                    for (size_t i = 0; i < numPoints && good; i++) {
+                        if (rgba[4 * i + 3] != 7 || halves[4 * i + 3].bits != 0x1234) {
+                            std::cerr << "Expr '" << exprs[e] << "' wrote past point " << i << std::endl;
+                            good = false;
+                        }
+                        for (int k = 0; k < 3; k++) {
+                            double value = single ? floatOut[3 * i + k] : out[3 * i + k];
+                            uint8_t expectedByte;
+                            Half expectedHalf;
+                            setChannelValue(expectedByte, value);
+                            setChannelValue(expectedHalf, value);
+                            // in single precision the native float variables hold the 8 bit colors rounded
+                            bool same = single ? std::abs(int(rgba[4 * i + k]) - int(expectedByte)) <= 1 &&
+                                                     std::abs(channelValue(halves[4 * i + k]) - value) <=
+                                                         1e-3 * (1 + std::abs(value))
+                                               : rgba[4 * i + k] == expectedByte &&
+                                                     halves[4 * i + k].bits == expectedHalf.bits;
+                            if (!same) {
+                                std::cerr << "Expr '" << exprs[e] << "' " << (single ? "float " : "")
+                                          << (parallel ? "parallel " : "") << "point " << i << "[" << k
+                                          << "] wrote " << int(rgba[4 * i + k]) << " and "
+                                          << channelValue(halves[4 * i + k]) << " for " << value << std::endl;
+                                good = false;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+    return good ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that evaluating expressions as a group (one program with their common ops computed once, or one LLVM loop
+// function) matches evaluating each of them on its own, with and without common op elimination, in double and single
+// precision, and that a member that can't be fused (evaluated with another precision) still gets evaluated
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExpressionGroup.h>
+#include <SeExpr2/Interpreter.h>
+#include <SeExpr2/VarBlock.h>
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+using namespace SeExpr2;
+
+namespace {
+
+const int numPoints = 21;
+
+const char* exprs[] = {"P*u + s",
+                       "a = P*u; b = a + s; noise(b) + a",
+                       "n = noise(P*u); n*2",
+                       "c = sin(u)*P; u > 0.5 ? c : -c",
+                       "sin(u)",
+                       "if (u > 0.3) { x = P*u; } else { x = P + s; } x*sin(u)",
+                       "def f(FLOAT x) { x*x + s } f(u) + f(P[1])",
+                       "def FLOAT[3] g(FLOAT[3] p) { p*u + s } g(P)*2",
+                       "[1, 2, 3]*2",
+                       "clamp(P*u + s, 0.2, 0.8)"};
+const int numExprs = sizeof(exprs) / sizeof(exprs[0]);
+
+}
+
+int main() {
+    VarBlockCreator creator;
+    int offP = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int offU = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int offS = creator.registerVariable("s", ExprType().FP(1).Uniform());
+    std::vector<int> offOut;
+    for (int e = 0; e < numExprs; e++)
+        offOut.push_back(creator.registerVariable("out" + std::to_string(e), ExprType().FP(3).Varying()));
+
+    std::vector<double> P(numPoints * 3), u(numPoints), s(1, 0.25);
+    for (int i = 0; i < numPoints; i++) {
+        u[i] = double(i) / (numPoints - 1);
+        P[3 * i] = i * 0.5;
+        P[3 * i + 1] = 1 - u[i];
+        P[3 * i + 2] = (i % 3) ? u[i] : 0;
+    }
+    std::vector<float> floatP(P.begin(), P.end()), floatU(u.begin(), u.end()), floatS(s.begin(), s.end());
+
+    std::vector<Expression::EvaluationStrategy> strategies = {Expression::UseInterpreter};
+#ifdef SEEXPR_ENABLE_LLVM
+    strategies.push_back(Expression::UseLLVM);
+#endif
+
+    bool good = true;
+    for (size_t pass = 0; pass < 2 * strategies.size(); pass++) {
+        Expression::EvaluationStrategy strategy = strategies[pass / 2];
+        bool single = pass % 2 == 1;
+        Expression::EvaluationPrecision evalPrecision = single ? Expression::UseFloat : Expression::UseDouble;
+        VarBlock block = creator.create();
+        std::vector<std::vector<double>> out(numExprs, std::vector<double>(numPoints * 3));
+        std::vector<std::vector<float>> floatOut(numExprs, std::vector<float>(numPoints * 3));
+        if (single) {
+            block.FloatPointer(offP) = floatP.data();
+            block.FloatPointer(offU) = floatU.data();
+            block.FloatPointer(offS) = floatS.data();
+            for (int e = 0; e < numExprs; e++) block.FloatPointer(offOut[e]) = floatOut[e].data();
+        } else {
+            block.Pointer(offP) = P.data();
+            block.Pointer(offU) = u.data();
+            block.Pointer(offS) = s.data();
+            for (int e = 0; e < numExprs; e++) block.Pointer(offOut[e]) = out[e].data();
+        }
+        auto result = [&](int e, int k) { return single ? double(floatOut[e][k]) : out[e][k]; };
+
+        // what every expression computes on its own
+        std::vector<std::unique_ptr<Expression>> expressions;
+        std::vector<std::vector<double>> expected(numExprs);
+        for (int e = 0; e < numExprs; e++) {
+            expressions.emplace_back(new Expression(exprs[e], TypeVec(3), strategy));
+            expressions.back()->setVarBlockCreator(&creator);
+            expressions.back()->setEvaluationPrecision(evalPrecision);
+            if (!expressions.back()->isValid()) {
+                std::cerr << "Expr '" << exprs[e] << "' invalid" << std::endl;
+                good = false;
+                continue;
+            }
+            expressions.back()->evalMultiple(&block, offOut[e], 0, numPoints);
+            for (int k = 0; k < numPoints * 3; k++) expected[e].push_back(result(e, k));
+        }
+
+        for (int cse = 0; cse < 2; cse++) {
+            Interpreter::eliminateCommon = cse == 1;
+            ExpressionGroup group;
+            for (int e = 0; e < numExprs; e++) group.add(expressions[e].get(), offOut[e]);
+            if (!group.isValid() || group.numFused() != static_cast<size_t>(numExprs)) {
+                std::cerr << "group invalid or not fused " << group.numFused() << std::endl;
+                good = false;
+            }
+            for (int e = 0; e < numExprs; e++) {
+                std::fill(out[e].begin(), out[e].end(), -1.);
+                std::fill(floatOut[e].begin(), floatOut[e].end(), -1.f);
+            }
+            group.evalMultiple(&block, 0, 5);
+            group.evalMultiple(&block, 5, numPoints);
+            for (int e = 0; e < numExprs; e++)
+                for (int k = 0; k < numPoints * 3; k++)
+                    if (std::fabs(result(e, k) - expected[e][k]) > 1e-12 * (1 + std::fabs(expected[e][k]))) {
+                        std::cerr << "Expr '" << exprs[e] << "' " << (single ? "float " : "") << (cse ? "cse " : "")
+                                  << "index " << k << " no match group=" << result(e, k)
+                                  << " expected=" << expected[e][k] << std::endl;
+                        good = false;
+                    }
+        }
+        Interpreter::eliminateCommon = true;
+    }
+
+    // a member of another precision is evaluated on its own
+    {
+        VarBlock block = creator.create();
+        std::vector<double> out0(numPoints * 3), out1(numPoints * 3);
+        block.Pointer(offP) = P.data();
+        block.Pointer(offU) = u.data();
+        block.Pointer(offS) = s.data();
+        block.Pointer(offOut[0]) = out0.data();
+        block.Pointer(offOut[1]) = out1.data();
+        Expression a(exprs[0], TypeVec(3), Expression::UseInterpreter), b(exprs[0], TypeVec(3));
+        a.setVarBlockCreator(&creator);
+        b.setVarBlockCreator(&creator);
+        b.setEvaluationPrecision(Expression::UseFloat);
+        ExpressionGroup group;
+        group.add(&a, offOut[0]);
+        group.add(&b, offOut[1]);
+        if (group.numFused() != 1) {
+            std::cerr << "group fused members of different precisions" << std::endl;
+            good = false;
+        }
+        group.evalMultiple(&block, 0, numPoints);
+        for (int k = 0; k < numPoints * 3; k++)
+            if (std::fabs(out0[k] - (P[k] * u[k / 3] + s[0])) > 1e-12) {
+                std::cerr << "group index " << k << " no match " << out0[k] << std::endl;
+                good = false;
+            }
+    }
+    return good ? 0 : 1;
+}
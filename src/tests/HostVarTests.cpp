@@ -0,0 +1,165 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that evalMultiple fetches the values of host variables (ones not in the var block) a batch at a time
+// through ExprVarRef::evalBatch, and that variables only implementing eval are evaluated at each point (read from the
+// variable block's indirectIndex)
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExprNode.h>
+#include <SeExpr2/Interpreter.h>
+#include <SeExpr2/VarBlock.h>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const size_t numPoints = 1000;
+
+// an attribute array of the host, eval reads the point of block's indirectIndex (or the one set by the host)
+struct Attribute : public ExprVarRef {
+    Attribute(int dim, bool batched) : ExprVarRef(ExprType().FP(dim).Varying()), batched(batched) {}
+
+    void eval(double* result) override {
+        evalCalls++;
+        int dim = type().dim();
+        for (int k = 0; k < dim; k++) result[k] = values[dim * (block ? block->indirectIndex : current) + k];
+    }
+    void eval(const char**) override {}
+    bool evalBatch(double* result, const int* indices, size_t n) override {
+        if (!batched) return ExprVarRef::evalBatch(result, indices, n);
+        batchCalls++;
+        int dim = type().dim();
+        for (size_t i = 0; i < n; i++)
+            for (int k = 0; k < dim; k++) result[dim * i + k] = values[dim * indices[i] + k];
+        return true;
+    }
+
+    bool batched;
+    std::vector<double> values;
+    size_t current = 0;
+    const VarBlock* block = nullptr;
+    size_t evalCalls = 0, batchCalls = 0;
+};
+
+// a uniform value only implementing eval
+struct Constant : public ExprVarRef {
+    Constant() : ExprVarRef(ExprType().FP(1).Varying()) {}
+    void eval(double* result) override { result[0] = 2.5; }
+    void eval(const char**) override {}
+};
+
+class HostExpr : public Expression {
+  public:
+    HostExpr(const std::string& expr) : Expression(expr, TypeVec(3), UseInterpreter), P(3, true), u(1, true) {}
+
+    ExprVarRef* resolveVar(const std::string& name) const override {
+        if (name == "P") return &P;
+        if (name == "u") return &u;
+        if (name == "k") return &k;
+        return nullptr;
+    }
+
+    mutable Attribute P, u;
+    mutable Constant k;
+};
+
+// the expressions and their value at a point
+struct Case {
+    const char* expr;
+    double (*value)(double P, double u);
+};
+
+Case cases[] = {{"P*u + k", [](double P, double u) { return P * u + 2.5; }},
+                {"u > .5 ? P*2 : -P", [](double P, double u) { return u > .5 ? P * 2 : -P; }},
+                {"x = P + k; if (u < .25) { x = x*u; } x",
+                 [](double P, double u) { return u < .25 ? (P + 2.5) * u : P + 2.5; }}};
+
+}
+
+int main() {
+    VarBlockCreator creator;
+    int outOffset = creator.registerVariable("out", ExprType().FP(3).Varying());
+
+    bool good = true;
+    for (const Case& c : cases)
+        for (int single = 0; single < 2; single++)
+            for (int batched = 0; batched < 2; batched++) {
+                HostExpr expr(c.expr);
+                expr.setVarBlockCreator(&creator);
+                expr.setEvaluationPrecision(single ? Expression::UseFloat : Expression::UseDouble);
+                expr.P.batched = expr.u.batched = batched != 0;
+                expr.P.values.resize(numPoints * 3);
+                expr.u.values.resize(numPoints);
+                for (size_t i = 0; i < numPoints; i++) {
+                    for (int k = 0; k < 3; k++) expr.P.values[3 * i + k] = double(i) * .25 + k;
+                    expr.u.values[i] = double(i * 37 % 100) / 100;
+                }
+                if (!expr.isValid()) {
+                    std::cerr << "Expr '" << c.expr << "' invalid: " << expr.parseError() << std::endl;
+                    good = false;
+                    continue;
+                }
+                // building the program evaluates the variables once
+                expr.P.evalCalls = expr.u.evalCalls = 0;
+
+                VarBlock block = creator.create();
+                expr.P.block = expr.u.block = &block;
+                std::vector<double> out(numPoints * 3);
+                std::vector<float> floatOut(numPoints * 3);
+                if (single)
+                    block.FloatPointer(outOffset) = floatOut.data();
+                else
+                    block.Pointer(outOffset) = out.data();
+                expr.evalMultiple(&block, outOffset, 0, numPoints);
+
+                for (size_t i = 0; i < numPoints; i++) {
+                    for (int k = 0; k < 3; k++) {
+                        double expected = c.value(expr.P.values[3 * i + k], expr.u.values[i]);
+                        double value = single ? floatOut[3 * i + k] : out[3 * i + k];
+                        if (std::abs(value - expected) > (single ? 1e-5 * (1 + std::abs(expected)) : 1e-12)) {
+                            std::cerr << "Expr '" << c.expr << "' " << (single ? "float " : "")
+                                      << (batched ? "batched " : "") << "point " << i << "[" << k << "] is " << value
+                                      << " instead of " << expected << std::endl;
+                            good = false;
+                            i = numPoints;
+                            break;
+                        }
+                    }
+                }
+
+                if (batched && expr.P.evalCalls + expr.u.evalCalls) {
+                    std::cerr << "Expr '" << c.expr << "' evaluated variables a point at a time" << std::endl;
+                    good = false;
+                }
+                if (!batched && expr.u.evalCalls < numPoints) {
+                    std::cerr << "Expr '" << c.expr << "' evaluated u " << expr.u.evalCalls << " times for "
+                              << numPoints << " points" << std::endl;
+                    good = false;
+                }
+                size_t batches = (numPoints + Interpreter::batchSize - 1) / Interpreter::batchSize;
+                if (batched && (expr.u.batchCalls < batches || expr.P.batchCalls < batches)) {
+                    std::cerr << "Expr '" << c.expr << "' fetched u " << expr.u.batchCalls << " and P "
+                              << expr.P.batchCalls << " times for " << batches << " batches" << std::endl;
+                    good = false;
+                }
+            }
+    return good ? 0 : 1;
+}
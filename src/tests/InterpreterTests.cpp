@@ -0,0 +1,278 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that the interpreter's batched evalMultiple and its optimizations (constant folding, uniform hoisting, op
+// fusion, slot reuse and inline expansion of local functions) match evaluating every point on its own with evalFP on
+// the unoptimized program (also when local functions are called rather than expanded), also with threads sharing one
+// expression through thread safe blocks, with tiered evaluation (which may switch to LLVM part way, and whose
+// expressions may be destroyed while compiling) and (up to float rounding) with single precision evaluation
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExprFunc.h>
+#include <SeExpr2/VarBlock.h>
+#include <SeExpr2/Interpreter.h>
+#include <SeExpr2/ExprNode.h>
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+#include <cmath>
+#include <memory>
+#include <thread>
+
+using namespace SeExpr2;
+
+namespace {
+
+//! A host variable that is not part of the variable block
+struct HostVar : public ExprVarRef {
+    HostVar() : ExprVarRef(ExprType().FP(1).Varying()) {}
+    void eval(double* result) override { result[0] = 1.5; }
+    void eval(const char** result) override {}
+    bool evalBatch(double* result, const int* indices, size_t n) override {
+        batchCalls++;
+        std::fill(result, result + n, 1.5);
+        return true;
+    }
+    size_t batchCalls = 0;
+};
+
+class TestExpr : public Expression {
+  public:
+    TestExpr(const std::string& expr, ExprType type, EvaluationStrategy strategy = UseInterpreter)
+        : Expression(expr, type, strategy) {}
+
+    ExprVarRef* resolveVar(const std::string& name) const override {
+        if (name == "hostVar") return &hostVar;
+        return nullptr;
+    }
+
+    mutable HostVar hostVar;
+};
+
+const int numPoints = 19;
+
+}
+
+int main() {
+    VarBlockCreator creator;
+    int offP = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int offU = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int offS = creator.registerVariable("s", ExprType().FP(1).Uniform());
+    int offOut = creator.registerVariable("out", ExprType().FP(3).Varying());
+    VarBlock block = creator.create();
+
+    std::vector<double> P(numPoints * 3), u(numPoints), s(1, 0.25), out(numPoints * 3);
+    for (int i = 0; i < numPoints; i++) {
+        u[i] = double(i) / (numPoints - 1);
+        P[3 * i] = i * 0.5;
+        P[3 * i + 1] = 1 - u[i];
+        P[3 * i + 2] = (i % 3) ? u[i] : 0;
+    }
+    P[0] = P[1] = P[2] = 0;
+    block.Pointer(offP) = P.data();
+    block.Pointer(offU) = u.data();
+    block.Pointer(offS) = s.data();
+    block.Pointer(offOut) = out.data();
+
+    std::vector<float> floatP(P.begin(), P.end()), floatU(u.begin(), u.end()), floatS(s.begin(), s.end());
+    std::vector<float> floatOut(numPoints * 3);
+    VarBlock floatBlock = creator.create();
+    floatBlock.FloatPointer(offP) = floatP.data();
+    floatBlock.FloatPointer(offU) = floatU.data();
+    floatBlock.FloatPointer(offS) = floatS.data();
+    floatBlock.FloatPointer(offOut) = floatOut.data();
+
+    const char* exprs[] = {"P*u+s",
+                           "u > 0.5 ? P : [u, s, 1]",
+                           "if (u < 0.3) { a = P; } else if (u < 0.7) { a = P*2; } else { a = -P; } a",
+                           "u > 0.2 && u < 0.8",
+                           "u < 0.2 || u > 0.8",
+                           "noise(P*3) + sin(u) + clamp(u, 0.2, 0.6)",
+                           "curve(u, 0, 0, 4, 1, 1, 4)",
+                           "P[1] + P[u*3]",
+                           "P == [0, 0, 0] ? 1 : cross(P, [0, 1, 0])",
+                           "\"abc\" == \"abc\" ? u : -u",
+                           "a = \"foo\"; a != \"foo\" ? 0 : u",
+                           "v = hostVar * u; v",
+                           "x = [u, u*2, u*3]; x % 0.5 ^ 2",
+                           "pow(u, 2) + fit(u, 0, 1, 2, 3) + !u + ~u",
+                           "P*u + P",
+                           "[1, 2, 3] + u*P",
+                           "a = P*2; b = a*u + s; b",
+                           "x = u; y = x*P; y - s/P",
+                           "u > 0.5 ? P*u + s : s*P",
+                           "a = P; b = P*2; c = a*u + (a + b); c",
+                           "a = u; if (u > 0.5) { a = u*2; b = P; } else { b = u; } a*b",
+                           "if (u > 0.3) { if (u > 0.6) { c = P; } else { c = -P; } } else { c = [s, s, s]; } c + 1",
+                           "t = \"x\"; if (u > 0.5) { t = \"y\"; } t == \"y\" ? P : -P",
+                           "a = P*u; b = a + s; c = b*b; d = sin(c) + cos(a); e = d*P; f = e - c; f + a*b",
+                           "t = s*2 + sin(s); P*t + [s, s*s, 1]",
+                           "q = s*3; if (u > 0.5) { q = q + u; } r = q*s; r + u",
+                           "s > 0.2 ? u*s : s",
+                           "k = [s, 2, 3] * 4; noise(k) + k",
+                           "c = [1, 2, 3] * 2 + sin(0.5); c",
+                           "2 > 1 ? [1, 2, 3] : [4, 5, 6]",
+                           "a = 5*u; b = 2 + 3; b*P + (1 < 2)",
+                           "x = [1, 2, 3]; y = x*2; if (u > 0.5) { y = y + u; } y",
+                           "def f(FLOAT x) { x*2 + s } f(u) + f(P[1])",
+                           "def FLOAT[3] g(FLOAT[3] a, FLOAT b) { c = a*b; c + 1 } g(P, u) + g([1, 2, 3], s)",
+                           "def f(FLOAT x) { x*x } f(f(u) + 1)",
+                           "def f(FLOAT x) { x*3 } f(2) + u",
+                           "def h(STRING t, FLOAT x) { t == \"a\" ? x : -x } h(\"a\", u) + h(\"b\", s)",
+                           "def f(FLOAT x) { x + u } def g(FLOAT y) { f(y)*f(y*2) } g(s) + g(P[0])",
+                           "def f(FLOAT x) { x*hostVar } u > 0.5 ? f(u) : f(P[2])*P",
+                           "def FLOAT[3] big(FLOAT[3] p, FLOAT k) { a = p*k + [1, 2, 3]; if (k > 0.5) { b = sin(a) + "
+                           "cos(p); } else { b = a*a - p; } c = b*k + noise(p); d = c/(1 + k*k); d + clamp(k, 0.2, "
+                           "0.8)*a } big(P, u) + big(P*2, s)",
+                           "t = \"tex_\" + \"a\"; t == \"tex_a\" ? u : -u",
+                           "if (u > 0.5) { a = \"x\"; } else { a = \"yy\"; } b = a + \"_\" + a; b == \"x_x\" ? P : u*P",
+                           "if (s > 0.2) { a = \"p\"; } else { a = \"q\"; } b = a + \"s\"; c = b + b; c != \"psps\" ? P : u"};
+
+    bool good = true;
+    const int inlineLimit = ExprLocalFunctionNode::inlineLimit;
+    auto evalSingle = [&](TestExpr& e, VarBlock& block) {
+        std::vector<double> result(numPoints * 3);
+        for (int i = 0; i < numPoints; i++) {
+            block.indirectIndex = i;
+            const double* f = e.evalFP(&block);
+            std::copy(f, f + 3, &result[3 * i]);
+        }
+        return result;
+    };
+    auto compare = [&](const char* str, const char* label, const std::vector<double>& a, const std::vector<double>& b) {
+        for (int i = 0; i < numPoints * 3; i++)
+            if (a[i] != b[i]) {
+                std::cerr << "Expr '" << str << "' index " << i << " no match " << label << "=" << a[i]
+                          << " expected=" << b[i] << std::endl;
+                good = false;
+            }
+    };
+
+    for (const char* str : exprs) {
+        Interpreter::fuseOps = Interpreter::reuseSlots = Interpreter::hoistUniform = Interpreter::foldConstants = false;
+        ExprLocalFunctionNode::inlineLimit = -1;
+        TestExpr reference(str, TypeVec(3));
+        reference.setVarBlockCreator(&creator);
+        if (!reference.isValid()) {
+            std::cerr << "Expr '" << str << "' invalid because\n" << reference.parseError() << std::endl;
+            good = false;
+            continue;
+        }
+        std::vector<double> expected = evalSingle(reference, block);
+        // procedure calls (which the reference doesn't expand) run in batches too
+        std::fill(out.begin(), out.end(), -1.);
+        reference.evalMultiple(&block, offOut, 0, numPoints);
+        compare(str, "batch calls", out, expected);
+        if (strstr(str, "def") && strstr(str, "hostVar") && !reference.hostVar.batchCalls) {
+            std::cerr << "Expr '" << str << "' called its functions a point at a time" << std::endl;
+            good = false;
+        }
+
+        Interpreter::fuseOps = Interpreter::reuseSlots = Interpreter::hoistUniform = Interpreter::foldConstants = true;
+        TestExpr called(str, TypeVec(3));
+        called.setVarBlockCreator(&creator);
+        called.isValid();
+        compare(str, "optimized calls", evalSingle(called, block), expected);
+        std::fill(out.begin(), out.end(), -1.);
+        called.evalMultiple(&block, offOut, 0, numPoints);
+        compare(str, "optimized batch calls", out, expected);
+
+        ExprLocalFunctionNode::inlineLimit = inlineLimit;
+        TestExpr e(str, TypeVec(3));
+        e.setVarBlockCreator(&creator);
+        e.isValid();
+        compare(str, "optimized", evalSingle(e, block), expected);
+
+        std::fill(out.begin(), out.end(), -1.);
+        e.evalMultiple(&block, offOut, 0, 3);
+        e.evalMultiple(&block, offOut, 3, numPoints);
+        compare(str, "batch", out, expected);
+
+        const int numThreads = 4;
+        std::vector<std::vector<double>> results(numThreads);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; t++)
+            threads.emplace_back([&, t]() {
+                VarBlock threadBlock = creator.create(true);
+                threadBlock.Pointer(offP) = P.data();
+                threadBlock.Pointer(offU) = u.data();
+                threadBlock.Pointer(offS) = s.data();
+                for (int pass = 0; pass < 2; pass++) results[t] = evalSingle(e, threadBlock);
+            });
+        for (std::thread& thread : threads) thread.join();
+        for (int t = 0; t < numThreads; t++) compare(str, "thread", results[t], expected);
+
+        Expression::tieredThreshold = numPoints;
+        TestExpr tiered(str, TypeVec(3), Expression::UseTiered);
+        tiered.setVarBlockCreator(&creator);
+        for (int pass = 0; pass < 3; pass++) {
+            std::fill(out.begin(), out.end(), -1.);
+            tiered.evalMultiple(&block, offOut, 0, numPoints);
+            compare(str, "tiered", out, expected);
+        }
+        // destroyed while its compile is queued or running, which drops the compile or waits for it
+        for (int k = 0; k < 3; k++) {
+            TestExpr dropped(str, TypeVec(3), Expression::UseTiered);
+            dropped.setVarBlockCreator(&creator);
+            dropped.evalMultiple(&block, offOut, 0, numPoints);
+        }
+
+        TestExpr single(str, TypeVec(3));
+        single.setVarBlockCreator(&creator);
+        single.setEvaluationPrecision(Expression::UseFloat);
+        single.isValid();
+        std::fill(floatOut.begin(), floatOut.end(), -1.f);
+        single.evalMultiple(&floatBlock, offOut, 0, numPoints);
+        for (int i = 0; i < numPoints * 3; i++)
+            if (std::fabs(floatOut[i] - expected[i]) > 1e-4 * (1 + std::fabs(expected[i]))) {
+                std::cerr << "Expr '" << str << "' index " << i << " no match float=" << floatOut[i]
+                          << " expected=" << expected[i] << std::endl;
+                good = false;
+            }
+    }
+
+    // a thread safe block cycling through more programs than it keeps frames for
+    std::vector<std::unique_ptr<TestExpr>> many;
+    for (int k = 0; k < 40; k++) {
+        many.emplace_back(new TestExpr("P*u + " + std::to_string(k), TypeVec(3)));
+        many.back()->setVarBlockCreator(&creator);
+    }
+    VarBlock cycling = creator.create(true);
+    cycling.Pointer(offP) = P.data();
+    cycling.Pointer(offU) = u.data();
+    cycling.Pointer(offS) = s.data();
+    for (int pass = 0; pass < 2; pass++)
+        for (int k = 0; k < 40; k++) {
+            cycling.indirectIndex = 1;
+            const double* f = many[k]->evalFP(&cycling);
+            if (f[0] != P[3] * u[1] + k) {
+                std::cerr << "Program " << k << " of a cycling block gave " << f[0] << std::endl;
+                good = false;
+            }
+        }
+    if (!cycling.frames || cycling.frames->frames.size() > InterpreterFrames::maxPrograms) {
+        std::cerr << "A cycling block kept " << (cycling.frames ? cycling.frames->frames.size() : 0) << " frames"
+                  << std::endl;
+        good = false;
+    }
+
+    // never destroyed and still compiling at exit, when the compiler thread is stopped and joined
+    TestExpr* leaked = new TestExpr("P*u + 1", TypeVec(3), Expression::UseTiered);
+    leaked->setVarBlockCreator(&creator);
+    leaked->evalMultiple(&block, offOut, 0, numPoints);
+    return good ? 0 : 1;
+}
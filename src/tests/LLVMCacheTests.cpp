@@ -0,0 +1,130 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that the LLVM cache directory keeps the machine code of each expression on its own: an expression compiled
+// with others (in a group) is found again when compiled alone or with different ones, custom function calls (curve)
+// included, and evaluates to what the code compiled for it did.
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExpressionGroup.h>
+#include <SeExpr2/VarBlock.h>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const size_t numPoints = 50;
+
+const char* exprs[] = {"curve(u, 0, 0, 4, 1, 1, 4) + u*P", "noise(P*3)*u", "sin(u) + P"};
+const int numExprs = sizeof(exprs) / sizeof(exprs[0]);
+
+size_t hits() { return Expression::llvmCacheHits(); }
+size_t misses() { return Expression::llvmCacheMisses(); }
+
+}
+
+int main() {
+#ifdef SEEXPR_ENABLE_LLVM
+    char directory[] = "/tmp/SeExpr2CacheXXXXXX";
+    if (!mkdtemp(directory)) {
+        std::cerr << "Can't create a cache directory" << std::endl;
+        return 1;
+    }
+    Expression::setLLVMCacheDirectory(directory);
+
+    VarBlockCreator creator;
+    int offP = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int offU = creator.registerVariable("u", ExprType().FP(1).Varying());
+    std::vector<int> offOut;
+    for (int e = 0; e < numExprs; e++)
+        offOut.push_back(creator.registerVariable("out" + std::to_string(e), ExprType().FP(3).Varying()));
+    int offAlone = creator.registerVariable("alone", ExprType().FP(3).Varying());
+
+    std::vector<double> P(numPoints * 3), u(numPoints), alone(numPoints * 3);
+    std::vector<std::vector<double>> out(numExprs, std::vector<double>(numPoints * 3));
+    for (size_t i = 0; i < numPoints; i++) {
+        u[i] = double(i) / (numPoints - 1);
+        for (int k = 0; k < 3; k++) P[3 * i + k] = double(i) * .1 + k;
+    }
+    VarBlock block = creator.create();
+    block.Pointer(offP) = P.data();
+    block.Pointer(offU) = u.data();
+    for (int e = 0; e < numExprs; e++) block.Pointer(offOut[e]) = out[e].data();
+    block.Pointer(offAlone) = alone.data();
+
+    std::vector<std::unique_ptr<Expression>> expressions;
+    auto expression = [&](int e) {
+        expressions.emplace_back(new Expression(exprs[e], TypeVec(3), Expression::UseLLVM));
+        expressions.back()->setVarBlockCreator(&creator);
+        return expressions.back().get();
+    };
+
+    bool good = true;
+    // first compiled together: every expression and the group are looked up (and compiled)
+    size_t hitsBefore = hits(), missesBefore = misses();
+    ExpressionGroup first;
+    first.add(expression(0), offOut[0]);
+    first.add(expression(1), offOut[1]);
+    first.evalMultiple(&block, 0, numPoints);
+    if (!first.isValid() || hits() != hitsBefore || misses() != missesBefore + 3) {
+        std::cerr << "First group: " << hits() - hitsBefore << " hits, " << misses() - missesBefore << " misses"
+                  << std::endl;
+        good = false;
+    }
+
+    // then alone (with nodes of its own for the custom function calls) and with another expression
+    for (int e = 0; e < 2; e++) {
+        hitsBefore = hits();
+        ExpressionGroup second;
+        second.add(expression(e), offAlone);
+        second.add(expression(2), offOut[2]);
+        second.evalMultiple(&block, 0, numPoints);
+        // the third expression is a miss the first time only
+        if (!second.isValid() || hits() != hitsBefore + (e == 0 ? 1 : 2)) {
+            std::cerr << "Expr '" << exprs[e] << "' wasn't found in the cache compiled with '" << exprs[2] << "'"
+                      << std::endl;
+            good = false;
+        }
+
+        hitsBefore = hits();
+        Expression* single = expression(e);
+        single->evalMultiple(&block, offAlone, 0, numPoints);
+        if (!single->isValid() || hits() != hitsBefore + 1) {
+            std::cerr << "Expr '" << exprs[e] << "' wasn't found in the cache compiled alone" << std::endl;
+            good = false;
+        }
+        for (size_t i = 0; i < numPoints * 3; i++)
+            if (alone[i] != out[e][i]) {
+                std::cerr << "Expr '" << exprs[e] << "' point " << i / 3 << " is " << alone[i] << " from the cache, "
+                          << out[e][i] << " when compiled" << std::endl;
+                good = false;
+                break;
+            }
+    }
+
+    Expression::setLLVMCacheDirectory("");
+    std::system(("rm -rf " + std::string(directory)).c_str());
+    return good ? 0 : 1;
+#else
+    return 0;
+#endif
+}
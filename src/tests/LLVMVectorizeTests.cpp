@@ -0,0 +1,80 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that the optimizer vectorizes the loop function LLVM compiles for expressions of varying variables (in
+// double and single precision) by looking at its optimized IR: the point loop of scalar expressions is vectorized
+// (it has a vector.body), vector expressions compute each point with vector types
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/VarBlock.h>
+#include <iostream>
+#include <string>
+
+using namespace SeExpr2;
+
+namespace {
+
+const char* exprs[] = {"u*2 + v*v", "u > .5 ? u*2 : v", "P*u + [1, 2, 3]"};
+const int dims[] = {1, 1, 3};
+
+//! The definition of the loop function in ir
+std::string loopFunction(const std::string& ir) {
+    for (size_t start = ir.find("define "); start != std::string::npos; start = ir.find("define ", start + 1)) {
+        size_t end = ir.find("\n}\n", start);
+        if (ir.find("_loopfunc(", start) < ir.find('\n', start)) return ir.substr(start, end - start);
+    }
+    return "";
+}
+
+}
+
+int main() {
+#ifdef SEEXPR_ENABLE_LLVM
+    Expression::debugging = true;
+    Expression::setLLVMCacheDirectory("");
+    VarBlockCreator creator;
+    creator.registerVariable("P", ExprType().FP(3).Varying());
+    creator.registerVariable("u", ExprType().FP(1).Varying());
+    creator.registerVariable("v", ExprType().FP(1).Varying());
+
+    bool good = true;
+    for (int e = 0; e < int(sizeof(exprs) / sizeof(exprs[0])); e++)
+        for (int single = 0; single < 2; single++) {
+            Expression expr(exprs[e], TypeVec(dims[e]), Expression::UseLLVM);
+            expr.setVarBlockCreator(&creator);
+            expr.setEvaluationPrecision(single ? Expression::UseFloat : Expression::UseDouble);
+            if (!expr.isValid()) {
+                std::cerr << "Expr '" << exprs[e] << "' invalid: " << expr.parseError() << std::endl;
+                good = false;
+                continue;
+            }
+            std::string loop = loopFunction(expr.llvmIR());
+            bool vectorLoop = loop.find("vector.body") != std::string::npos;
+            // single precision data is loaded as float vectors (and math the optimizer can narrow stays in float)
+            bool vectorTypes = loop.find(single ? " x float>" : " x double>") != std::string::npos;
+            if ((dims[e] == 1 && !vectorLoop) || !vectorTypes) {
+                std::cerr << "Expr '" << exprs[e] << "'" << (single ? " in single precision" : "")
+                          << " isn't vectorized:\n"
+                          << loop << std::endl;
+                good = false;
+            }
+        }
+    return good ? 0 : 1;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,165 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that the thread pool runs every chunk of a loop exactly once (with exceptions and nested loops), and that
+// evalMultipleParallel computes what evalMultiple does for various thread counts, grains and precisions
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExprNode.h>
+#include <SeExpr2/ThreadPool.h>
+#include <SeExpr2/VarBlock.h>
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const char* exprs[] = {"P*u + [1, 2, 3]",
+                       "noise(P*3) + fbm(P, 4)*u",
+                       "u > .5 ? P*sin(u*4) : -P",
+                       "if (u < .3) { x = P*2; } else { x = P + u; } x*cos(u)",
+                       "def FLOAT[3] f(FLOAT[3] p) { p*p + u } f(P)*2 + f(P*u)",
+                       "voronoi(P*2, 3) + s"};
+const int numExprs = sizeof(exprs) / sizeof(exprs[0]);
+
+bool testPool() {
+    std::atomic<bool> good(true);
+    const size_t n = 10007;
+    ThreadPool pool(4);
+    for (size_t grain : {1, 7, 64, 5000, 20000}) {
+        std::vector<std::atomic<int>> hits(n);
+        for (auto& hit : hits) hit = 0;
+        std::vector<std::atomic<int>> busy(pool.numThreads());
+        for (auto& b : busy) b = 0;
+        pool.parallelFor(3, n, grain, [&](int worker, size_t start, size_t end) {
+            if (busy[worker]++) good = false;  // worker indices must be unique among running chunks
+            if ((start - 3) % grain || (end - start > grain) || (end < n && end - start != grain)) good = false;
+            for (size_t i = start; i < end; i++) hits[i]++;
+            busy[worker]--;
+        });
+        for (size_t i = 0; i < n; i++)
+            if (hits[i] != (i >= 3)) {
+                std::cerr << "grain " << grain << " index " << i << " run " << hits[i] << " times" << std::endl;
+                good = false;
+                break;
+            }
+    }
+
+    // a loop started from a loop runs on its thread, an exception comes out of parallelFor
+    std::atomic<size_t> total(0);
+    pool.parallelFor(0, 100, 10, [&](int, size_t start, size_t end) {
+        pool.parallelFor(start, end, 3, [&](int, size_t s, size_t e) { total += e - s; });
+    });
+    if (total != 100) {
+        std::cerr << "nested loops ran " << total << " points" << std::endl;
+        good = false;
+    }
+    bool caught = false;
+    try {
+        pool.parallelFor(0, 100, 1, [&](int, size_t start, size_t) {
+            if (start == 42) throw std::runtime_error("chunk failed");
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    if (!caught) {
+        std::cerr << "exception not rethrown" << std::endl;
+        good = false;
+    }
+    return good;
+}
+
+}
+
+int main() {
+    bool good = testPool();
+
+    VarBlockCreator creator;
+    int offP = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int offU = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int offS = creator.registerVariable("s", ExprType().FP(1).Uniform());
+    int offOut = creator.registerVariable("out", ExprType().FP(3).Varying());
+
+    const size_t numPoints = 20011;
+    std::vector<double> P(numPoints * 3), u(numPoints), s(1, .25);
+    for (size_t i = 0; i < numPoints; i++) {
+        u[i] = double(i % 1000) / 999;
+        P[3 * i] = i * 0.001;
+        P[3 * i + 1] = 1 - u[i];
+        P[3 * i + 2] = (i % 3) * u[i];
+    }
+    std::vector<float> floatP(P.begin(), P.end()), floatU(u.begin(), u.end()), floatS(s.begin(), s.end());
+
+    std::vector<Expression::EvaluationStrategy> strategies = {Expression::UseInterpreter};
+#ifdef SEEXPR_ENABLE_LLVM
+    strategies.push_back(Expression::UseLLVM);
+#endif
+    ThreadPool& pool = ThreadPool::global();
+    int defaultThreads = pool.numThreads();
+    for (Expression::EvaluationStrategy strategy : strategies)
+        for (int single = 0; single < 2; single++)
+            for (int e = 0; e < numExprs; e++) {
+                Expression expr(exprs[e], TypeVec(3), strategy);
+                expr.setVarBlockCreator(&creator);
+                expr.setEvaluationPrecision(single ? Expression::UseFloat : Expression::UseDouble);
+                if (!expr.isValid()) {
+                    std::cerr << "Expr '" << exprs[e] << "' invalid: " << expr.parseError() << std::endl;
+                    good = false;
+                    continue;
+                }
+                VarBlock block = creator.create();
+                std::vector<double> expected(numPoints * 3), out(numPoints * 3);
+                std::vector<float> floatExpected(numPoints * 3), floatOut(numPoints * 3);
+                if (single) {
+                    block.FloatPointer(offP) = floatP.data();
+                    block.FloatPointer(offU) = floatU.data();
+                    block.FloatPointer(offS) = floatS.data();
+                    block.FloatPointer(offOut) = floatExpected.data();
+                } else {
+                    block.Pointer(offP) = P.data();
+                    block.Pointer(offU) = u.data();
+                    block.Pointer(offS) = s.data();
+                    block.Pointer(offOut) = expected.data();
+                }
+                expr.evalMultiple(&block, offOut, 5, numPoints);
+
+                for (int threads : {1, 3, 8})
+                    for (size_t grain : {0, 8, 1000}) {
+                        pool.setNumThreads(threads);
+                        Expression::parallelGrain = grain;
+                        std::fill(out.begin(), out.end(), 0.);
+                        std::fill(floatOut.begin(), floatOut.end(), 0.f);
+                        if (single)
+                            block.FloatPointer(offOut) = floatOut.data();
+                        else
+                            block.Pointer(offOut) = out.data();
+                        expr.evalMultipleParallel(&block, offOut, 5, numPoints);
+                        bool same = single ? floatOut == floatExpected : out == expected;
+                        if (!same) {
+                            std::cerr << "Expr '" << exprs[e] << "' " << (single ? "float " : "") << threads
+                                      << " threads grain " << grain << " differs from evalMultiple" << std::endl;
+                            good = false;
+                        }
+                    }
+            }
+    pool.setNumThreads(defaultThreads);
+    Expression::parallelGrain = 0;
+    return good ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Stands in for a library precompile wrote, so that PrecompiledTests can bind expressions in builds without LLVM.
+// It holds "x*2 + 1" returning a varying float, with x the first (double) variable of the block, compiled for a
+// generic cpu, and "x*4 + 1" compiled for one that needs avx2. The symbols are named after the hash of the key
+// without the target (see precompiledSymbol), so they change whenever codeKey's format does.
+
+#include <cstdint>
+
+extern "C" {
+
+//! How many times the code below ran, read by PrecompiledTests to tell it from the interpreter
+int PrecompiledTestCalls = 0;
+
+extern const char SeExpr2AOT_d8903ee3af6d5240_key[];
+const char SeExpr2AOT_d8903ee3af6d5240_key[] =
+    "type varying Float double\n"
+    "x*2 + 1\n"
+    "var x varying Float 0 1\n"
+    "target generic\n"
+    "isa baseline\n";
+
+void SeExpr2AOT_d8903ee3af6d5240_func(double* result, char** data, uint32_t index, void* strings) {
+    PrecompiledTestCalls++;
+    result[0] = reinterpret_cast<double*>(data[0])[index] * 2 + 1;
+}
+
+void SeExpr2AOT_d8903ee3af6d5240_loopfunc(char** data, uint32_t outputOffset, uint32_t rangeStart,
+                                          uint32_t rangeEnd, void* strings) {
+    PrecompiledTestCalls++;
+    const double* x = reinterpret_cast<double*>(data[0]);
+    double* out = reinterpret_cast<double*>(data[outputOffset]);
+    for (uint32_t i = rangeStart; i < rangeEnd; i++) out[i] = x[i] * 2 + 1;
+}
+
+extern const char SeExpr2AOT_985e2bbb09bf6586_key[];
+const char SeExpr2AOT_985e2bbb09bf6586_key[] =
+    "type varying Float double\n"
+    "x*4 + 1\n"
+    "var x varying Float 0 1\n"
+    "target haswell\n"
+    "isa avx2\n";
+
+void SeExpr2AOT_985e2bbb09bf6586_func(double* result, char** data, uint32_t index, void* strings) {
+    PrecompiledTestCalls++;
+    result[0] = reinterpret_cast<double*>(data[0])[index] * 4 + 1;
+}
+
+void SeExpr2AOT_985e2bbb09bf6586_loopfunc(char** data, uint32_t outputOffset, uint32_t rangeStart,
+                                          uint32_t rangeEnd, void* strings) {
+    PrecompiledTestCalls++;
+    const double* x = reinterpret_cast<double*>(data[0]);
+    double* out = reinterpret_cast<double*>(data[outputOffset]);
+    for (uint32_t i = rangeStart; i < rangeEnd; i++) out[i] = x[i] * 4 + 1;
+}
+}
@@ -0,0 +1,143 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that Expression::loadPrecompiled's library is bound to the expressions it holds code for (with UseLLVM and
+// UseTiered, which then need no LLVM) and not to the others, nor to code for a cpu above the selected instruction
+// set level. The library is PrecompiledTestLibrary.cpp's.
+
+#include <SeExpr2/CPUDispatch.h>
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/VarBlock.h>
+#include <dlfcn.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const size_t numPoints = 100;
+
+//! Evaluates expr over all points and at point 7 alone, checking the results against scale*x + 1. callsMade gets
+//! how many times the library's code ran meanwhile.
+bool check(Expression& expr, VarBlockCreator& creator, int outOffset, const std::vector<double>& x, double scale,
+           const int* calls, int& callsMade) {
+    int callsBefore = *calls;
+    if (!expr.isValid()) {
+        std::cerr << "Expr '" << expr.getExpr() << "' invalid: " << expr.parseError() << std::endl;
+        return false;
+    }
+    VarBlock block = creator.create();
+    std::vector<double> out(numPoints);
+    block.Pointer(0) = const_cast<double*>(x.data());
+    block.Pointer(outOffset) = out.data();
+    expr.evalMultiple(&block, outOffset, 0, numPoints);
+    block.indirectIndex = 7;
+    double single = expr.evalFP(&block)[0];
+    callsMade = *calls - callsBefore;
+
+    for (size_t i = 0; i < numPoints; i++)
+        if (out[i] != scale * x[i] + 1) {
+            std::cerr << "Expr '" << expr.getExpr() << "' point " << i << " is " << out[i] << std::endl;
+            return false;
+        }
+    if (single != scale * x[7] + 1) {
+        std::cerr << "Expr '" << expr.getExpr() << "' point 7 alone is " << single << std::endl;
+        return false;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "usage: PrecompiledTests library" << std::endl;
+        return 1;
+    }
+    if (!Expression::loadPrecompiled(argv[1])) return 1;
+    // the library is loaded already, this only finds the counter of calls into it
+    void* library = dlopen(argv[1], RTLD_NOW | RTLD_NOLOAD);
+    const int* calls = library ? (const int*)dlsym(library, "PrecompiledTestCalls") : nullptr;
+    if (!calls) {
+        std::cerr << "PrecompiledTestCalls not found in " << argv[1] << std::endl;
+        return 1;
+    }
+
+    VarBlockCreator creator;
+    creator.registerVariable("x", ExprType().FP(1).Varying());
+    int outOffset = creator.registerVariable("out", ExprType().FP(1).Varying());
+    std::vector<double> x(numPoints);
+    for (size_t i = 0; i < numPoints; i++) x[i] = double(i) * .5 - 3;
+
+    bool good = true;
+    for (Expression::EvaluationStrategy strategy : {Expression::UseLLVM, Expression::UseTiered}) {
+        std::string name = strategy == Expression::UseLLVM ? "UseLLVM" : "UseTiered";
+        // the library's expression runs its code: once for the range, once for the single point
+        Expression expr("x*2 + 1", ExprType().FP(1).Varying(), strategy);
+        expr.setVarBlockCreator(&creator);
+        int callsMade = 0;
+        good &= check(expr, creator, outOffset, x, 2, calls, callsMade);
+        if (callsMade != 2) {
+            std::cerr << name << " ran the precompiled code " << callsMade << " times instead of 2" << std::endl;
+            good = false;
+        }
+    }
+
+    // another expression (tiered, which needs no LLVM either) is interpreted
+    Expression other("x*3 + 1", ExprType().FP(1).Varying(), Expression::UseTiered);
+    other.setVarBlockCreator(&creator);
+    int callsMade = 0;
+    good &= check(other, creator, outOffset, x, 3, calls, callsMade);
+    if (callsMade != 0) {
+        std::cerr << "'x*3 + 1' ran the precompiled code" << std::endl;
+        good = false;
+    }
+
+    // and the library's avx2 expression when avx2 isn't selected, or runs its code when it is
+    for (ISALevel level : {ISABaseline, ISAAVX2}) {
+        if (level > hostISALevel()) continue;
+        setISALevel(level);
+        Expression avx2("x*4 + 1", ExprType().FP(1).Varying(), Expression::UseTiered);
+        avx2.setVarBlockCreator(&creator);
+        good &= check(avx2, creator, outOffset, x, 4, calls, callsMade);
+        if (callsMade != (level == ISAAVX2 ? 2 : 0)) {
+            std::cerr << "'x*4 + 1' ran the precompiled code " << callsMade << " times with " << isaLevelName(level)
+                      << " selected" << std::endl;
+            good = false;
+        }
+    }
+    setISALevel(hostISALevel());
+
+    // so is the library's expression in single precision (its key differs)
+    Expression single("x*2 + 1", ExprType().FP(1).Varying(), Expression::UseTiered);
+    single.setVarBlockCreator(&creator);
+    single.setEvaluationPrecision(Expression::UseFloat);
+    if (!single.isValid()) return 1;
+    std::vector<float> floatX(x.begin(), x.end()), floatOut(numPoints);
+    VarBlock block = creator.create();
+    block.FloatPointer(0) = floatX.data();
+    block.FloatPointer(outOffset) = floatOut.data();
+    int callsBefore = *calls;
+    single.evalMultiple(&block, outOffset, 0, numPoints);
+    if (*calls != callsBefore || floatOut[5] != floatX[5] * 2 + 1) {
+        std::cerr << "single precision 'x*2 + 1' ran the precompiled code" << std::endl;
+        good = false;
+    }
+    return good ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that evaluating a subset of the points of a var block (listed or masked) writes what evaluating all of them
+// does to the points of the subset and leaves the outputs of the others alone
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExpressionGroup.h>
+#include <SeExpr2/ExprNode.h>
+#include <SeExpr2/VarBlock.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const size_t numPoints = 1000;
+const double untouched = -1234.5;
+
+// batchable, with a branch, not batchable (local function) and varying by point only through u
+const char* exprs[] = {"P*u + [1, 2, 3]", "u > .5 ? P*2 : noise(P)", "def FLOAT[3] f(FLOAT[3] p) { p*u } f(P) + P",
+                       "[u, u*u, 1]"};
+const int numExprs = sizeof(exprs) / sizeof(exprs[0]);
+
+// the subsets: in order with runs and gaps, scattered in reverse order, a single point and none
+std::vector<std::vector<uint32_t>> subsets() {
+    std::vector<std::vector<uint32_t>> sets(4);
+    for (uint32_t i = 0; i < numPoints; i++)
+        if (i % 7 < 4 || i % 31 == 0) sets[0].push_back(i);
+    for (uint32_t i = numPoints; i-- > 0;)
+        if (i * 2654435761u % 5 == 0) sets[1].push_back(i);
+    sets[2].push_back(numPoints - 1);
+    return sets;
+}
+
+template <class T>
+bool check(const std::string& what, const std::vector<T>& full, const std::vector<T>& sparse,
+           const std::vector<bool>& selected, int dim) {
+    for (size_t i = 0; i < numPoints; i++)
+        for (int k = 0; k < dim; k++) {
+            T expected = selected[i] ? full[dim * i + k] : T(untouched);
+            if (sparse[dim * i + k] != expected) {
+                std::cerr << what << " point " << i << "[" << k << "] is " << sparse[dim * i + k] << " instead of "
+                          << expected << std::endl;
+                return false;
+            }
+        }
+    return true;
+}
+
+}
+
+int main() {
+    VarBlockCreator creator;
+    int pOffset = creator.registerVariable("P", ExprType().FP(3).Varying());
+    int uOffset = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int outOffset = creator.registerVariable("out", ExprType().FP(3).Varying());
+    int out2Offset = creator.registerVariable("out2", ExprType().FP(3).Varying());
+    int nameOffset = creator.registerVariable("name", ExprType().String().Varying());
+    int strOffset = creator.registerVariable("str", ExprType().String().Varying());
+
+    std::vector<double> P(numPoints * 3), u(numPoints);
+    std::vector<std::string> names(numPoints);
+    std::vector<const char*> namePointers(numPoints);
+    for (size_t i = 0; i < numPoints; i++) {
+        for (int k = 0; k < 3; k++) P[3 * i + k] = double(i) * .01 + k;
+        u[i] = double(i * 13 % 100) / 100;
+        names[i] = "n" + std::to_string(i);
+        namePointers[i] = names[i].c_str();
+    }
+    std::vector<float> floatP(P.begin(), P.end()), floatU(u.begin(), u.end());
+
+    std::vector<std::vector<uint32_t>> sets = subsets();
+    std::vector<Expression::EvaluationStrategy> strategies = {Expression::UseInterpreter};
+#ifdef SEEXPR_ENABLE_LLVM
+    strategies.push_back(Expression::UseLLVM);
+#endif
+    bool good = true;
+    for (Expression::EvaluationStrategy strategy : strategies) {
+        for (int single = 0; single < 2; single++)
+            for (int e = 0; e < numExprs; e++) {
+                Expression expr(exprs[e], TypeVec(3), strategy), other(exprs[(e + 1) % numExprs], TypeVec(3), strategy);
+                for (Expression* x : {&expr, &other}) {
+                    x->setVarBlockCreator(&creator);
+                    x->setEvaluationPrecision(single ? Expression::UseFloat : Expression::UseDouble);
+                }
+                if (!expr.isValid()) {
+                    std::cerr << "Expr '" << exprs[e] << "' invalid: " << expr.parseError() << std::endl;
+                    good = false;
+                    continue;
+                }
+                ExpressionGroup group;
+                group.add(&expr, outOffset);
+                group.add(&other, out2Offset);
+
+                VarBlock block = creator.create();
+                std::vector<double> full(numPoints * 3), full2(numPoints * 3);
+                std::vector<float> floatFull(numPoints * 3), floatFull2(numPoints * 3);
+                if (single) {
+                    block.FloatPointer(pOffset) = floatP.data();
+                    block.FloatPointer(uOffset) = floatU.data();
+                    block.FloatPointer(outOffset) = floatFull.data();
+                    block.FloatPointer(out2Offset) = floatFull2.data();
+                } else {
+                    block.Pointer(pOffset) = P.data();
+                    block.Pointer(uOffset) = u.data();
+                    block.Pointer(outOffset) = full.data();
+                    block.Pointer(out2Offset) = full2.data();
+                }
+                group.evalMultiple(&block, 0, numPoints);
+
+                for (size_t s = 0; s < sets.size(); s++)
+                    for (int how = 0; how < 3; how++) {
+                        // how: 0 listed, 1 masked, 2 listed with the group
+                        const std::vector<uint32_t>& set = sets[s];
+                        std::vector<bool> selected(numPoints);
+                        std::vector<uint64_t> mask((numPoints + 63) / 64);
+                        for (uint32_t i : set) {
+                            selected[i] = true;
+                            mask[i / 64] |= uint64_t(1) << (i % 64);
+                        }
+                        std::vector<double> sparse(numPoints * 3, untouched), sparse2(numPoints * 3, untouched);
+                        std::vector<float> floatSparse(numPoints * 3, untouched);
+                        std::vector<float> floatSparse2(numPoints * 3, untouched);
+                        if (single) {
+                            block.FloatPointer(outOffset) = floatSparse.data();
+                            block.FloatPointer(out2Offset) = floatSparse2.data();
+                        } else {
+                            block.Pointer(outOffset) = sparse.data();
+                            block.Pointer(out2Offset) = sparse2.data();
+                        }
+                        if (how == 0)
+                            expr.evalMultipleIndexed(&block, outOffset, set.data(), set.size());
+                        else if (how == 1)
+                            expr.evalMultipleMasked(&block, outOffset, mask.data(), 0, numPoints);
+                        else
+                            group.evalMultipleIndexed(&block, set.data(), set.size());
+
+                        std::string what = std::string("Expr '") + exprs[e] + "' " + (single ? "float " : "") +
+                                           "subset " + std::to_string(s) + " way " + std::to_string(how);
+                        if (single) {
+                            good &= check(what, floatFull, floatSparse, selected, 3);
+                            if (how == 2) good &= check(what + " second", floatFull2, floatSparse2, selected, 3);
+                        } else {
+                            good &= check(what, full, sparse, selected, 3);
+                            if (how == 2) good &= check(what + " second", full2, sparse2, selected, 3);
+                        }
+                    }
+            }
+
+        // a mask over part of the points, and string outputs
+        Expression expr("name + \"_\" + name", ExprType().String(), strategy);
+        Expression other("\"other \" + name + name", ExprType().String(), strategy);
+        expr.setVarBlockCreator(&creator);
+        other.setVarBlockCreator(&creator);
+        VarBlock block = creator.create();
+        std::vector<const char*> out(numPoints, nullptr), otherOut(numPoints, nullptr);
+        block.CharPointer(nameOffset) = const_cast<char**>(namePointers.data());
+        block.CharPointer(strOffset) = const_cast<char**>(out.data());
+        std::vector<uint64_t> mask((numPoints + 63) / 64, 0x5555555555555555ull);
+        size_t rangeStart = 70, rangeEnd = 901;
+        expr.evalMultipleMasked(&block, strOffset, mask.data(), rangeStart, rangeEnd);
+        // strings built after the call must not take the place of any of the outputs (all stay valid until expr is
+        // evaluated again)
+        block.CharPointer(strOffset) = const_cast<char**>(otherOut.data());
+        other.evalMultipleMasked(&block, strOffset, mask.data(), 0, numPoints);
+        for (size_t i = 0; i < numPoints; i++) {
+            bool selected = i >= rangeStart && i < rangeEnd && i % 2 == 0;
+            if (selected ? !out[i] || names[i] + "_" + names[i] != out[i] : out[i] != nullptr) {
+                std::cerr << "string point " << i << " is " << (out[i] ? out[i] : "(null)") << std::endl;
+                good = false;
+                break;
+            }
+        }
+
+        // variables and an output of other formats, with strides (the scattered points are gathered and scattered
+        // back with their layout)
+        VarBlockCreator channels;
+        int channelU = channels.registerVariable("u", ExprType().FP(1).Varying(), ChannelType::UInt8);
+        int channelP = channels.registerVariable("P", ExprType().FP(3).Varying(), ChannelType::Float32, 16);
+        int channelOut = channels.registerVariable("out", ExprType().FP(3).Varying(), ChannelType::Float32, 16);
+        Expression channelExpr(exprs[0], TypeVec(3), strategy);
+        channelExpr.setVarBlockCreator(&channels);
+        std::vector<uint8_t> byteU(numPoints);
+        // the fourth element of a point is only padding, left alone by both evaluations
+        std::vector<float> stridedP(numPoints * 4), channelFull(numPoints * 4, untouched),
+            channelSparse(numPoints * 4, untouched);
+        for (size_t i = 0; i < numPoints; i++) {
+            byteU[i] = static_cast<uint8_t>(i * 7);
+            for (int k = 0; k < 3; k++) stridedP[4 * i + k] = floatP[3 * i + k];
+        }
+        VarBlock channelBlock = channels.create();
+        channelBlock.CharPointer(channelU) = reinterpret_cast<char**>(byteU.data());
+        channelBlock.FloatPointer(channelP) = stridedP.data();
+        channelBlock.FloatPointer(channelOut) = channelFull.data();
+        channelExpr.evalMultiple(&channelBlock, channelOut, 0, numPoints);
+        channelBlock.FloatPointer(channelOut) = channelSparse.data();
+        channelExpr.evalMultipleIndexed(&channelBlock, channelOut, sets[1].data(), sets[1].size());
+        std::vector<bool> selected(numPoints);
+        for (uint32_t i : sets[1]) selected[i] = true;
+        good &= check("channels", channelFull, channelSparse, selected, 4);
+    }
+    return good ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Checks that string expressions read string variables from a var block and that evalMultiple writes their strings
+// to a string output, with both evaluators
+
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/ExprNode.h>
+#include <SeExpr2/VarBlock.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace SeExpr2;
+
+namespace {
+
+const size_t numPoints = 301;
+
+std::string pointName(size_t i) { return "pt" + std::to_string(i); }
+
+// the expressions and what they evaluate to at a point
+struct Case {
+    const char* expr;
+    std::string (*expected)(size_t i, double u, const std::string& suffix);
+};
+
+Case cases[] = {
+    {"name", [](size_t i, double, const std::string&) { return pointName(i); }},
+    {"name + suffix", [](size_t i, double, const std::string& suffix) { return pointName(i) + suffix; }},
+    {"u > .5 ? name + \"_\" + suffix : suffix",
+     [](size_t i, double u, const std::string& suffix) { return u > .5 ? pointName(i) + "_" + suffix : suffix; }},
+    {"x = name; y = x + x; u < .25 ? \"low\" : y",
+     [](size_t i, double u, const std::string&) { return u < .25 ? std::string("low") : pointName(i) + pointName(i); }},
+};
+
+}
+
+int main() {
+    VarBlockCreator creator;
+    int nameOffset = creator.registerVariable("name", ExprType().String().Varying());
+    int suffixOffset = creator.registerVariable("suffix", ExprType().String().Uniform());
+    int uOffset = creator.registerVariable("u", ExprType().FP(1).Varying());
+    int outOffset = creator.registerVariable("out", ExprType().String().Varying());
+
+    std::vector<std::string> names(numPoints);
+    std::vector<const char*> namePointers(numPoints);
+    std::vector<double> u(numPoints);
+    for (size_t i = 0; i < numPoints; i++) {
+        names[i] = pointName(i);
+        namePointers[i] = names[i].c_str();
+        u[i] = double(i * 7 % 100) / 100;
+    }
+    std::string suffix = "tail";
+    const char* suffixPointer = suffix.c_str();
+
+    std::vector<Expression::EvaluationStrategy> strategies = {Expression::UseInterpreter};
+#ifdef SEEXPR_ENABLE_LLVM
+    strategies.push_back(Expression::UseLLVM);
+#endif
+    bool good = true;
+    for (Expression::EvaluationStrategy strategy : strategies)
+        for (const Case& c : cases) {
+            Expression expr(c.expr, ExprType().String(), strategy);
+            expr.setVarBlockCreator(&creator);
+            if (!expr.isValid()) {
+                std::cerr << "Expr '" << c.expr << "' invalid: " << expr.parseError() << std::endl;
+                good = false;
+                continue;
+            }
+            for (int mode = 0; mode < 3; mode++) {
+                // mode 0 evaluates serially, 1 in parallel and 2 with a thread safe block
+                VarBlock block = creator.create(mode == 2);
+                std::vector<const char*> out(numPoints, nullptr);
+                block.CharPointer(nameOffset) = const_cast<char**>(namePointers.data());
+                block.CharPointer(suffixOffset) = const_cast<char**>(&suffixPointer);
+                block.Pointer(uOffset) = u.data();
+                block.CharPointer(outOffset) = const_cast<char**>(out.data());
+                if (mode == 1)
+                    expr.evalMultipleParallel(&block, outOffset, 0, numPoints);
+                else
+                    expr.evalMultiple(&block, outOffset, 0, numPoints);
+
+                for (size_t i = 0; i < numPoints; i++) {
+                    std::string expected = c.expected(i, u[i], suffix);
+                    if (!out[i] || expected != out[i]) {
+                        std::cerr << "Expr '" << c.expr << "' mode " << mode << " point " << i << " gave '"
+                                  << (out[i] ? out[i] : "(null)") << "' instead of '" << expected << "'" << std::endl;
+                        good = false;
+                        break;
+                    }
+                }
+            }
+        }
+    return good ? 0 : 1;
+}
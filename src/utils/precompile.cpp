@@ -0,0 +1,136 @@
+/*
+ Copyright Disney Enterprises, Inc.  All rights reserved.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License
+ and the following modification to it: Section 6 Trademarks.
+ deleted and replaced with:
+
+ 6. Trademarks. This License does not grant permission to use the
+ trade names, trademarks, service marks, or product names of the
+ Licensor and its affiliates, except as required for reproducing
+ the content of the NOTICE file.
+
+ You may obtain a copy of the License at
+ http://www.apache.org/licenses/LICENSE-2.0
+*/
+
+// Compiles expressions ahead of time into a shared library that Expression::loadPrecompiled binds matching
+// expressions to, so that they run without being compiled (or LLVM) where they're used
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <SeExpr2/Expression.h>
+#include <SeExpr2/VarBlock.h>
+using namespace SeExpr2;
+
+namespace {
+
+void usage() {
+    std::cerr << "usage: precompile [-o library] [-cpu name] [-float] [-type type] [-var name type]...\n"
+                 "                  [-uniform name type]... file...\n"
+                 "Compiles the expression in each file into library (expressions.so by default, an object file\n"
+                 "if it ends in .o). Variables are registered in a VarBlockCreator in the order given, types are\n"
+                 "FLOAT, FLOAT[n] or STRING. The code is for a generic cpu of the architecture, which any host\n"
+                 "runs, unless one is given (-cpu host for the host's). Code for a cpu above the instruction set\n"
+                 "level selected where the library is loaded isn't used there." << std::endl;
+}
+
+//! Parses FLOAT, FLOAT[n] or STRING
+bool parseType(const char* str, ExprType& type) {
+    int dim = 1;
+    if (!strcmp(str, "STRING"))
+        type = ExprType().String();
+    else if (!strcmp(str, "FLOAT") || (sscanf(str, "FLOAT[%d]", &dim) == 1 && dim > 0))
+        type = ExprType().FP(dim);
+    else
+        return false;
+    return true;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    std::string output = "expressions.so", cpu;
+    ExprType type = ExprType().FP(3).Varying();
+    Expression::EvaluationPrecision precision = Expression::UseDouble;
+    VarBlockCreator creator;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc, hasTwoValues = i + 2 < argc;
+        ExprType varType;
+        if (arg == "-o" && hasValue)
+            output = argv[++i];
+        else if (arg == "-cpu" && hasValue)
+            cpu = argv[++i];
+        else if (arg == "-float")
+            precision = Expression::UseFloat;
+        else if (arg == "-type" && hasValue && parseType(argv[i + 1], type))
+            type.Varying(), i++;
+        else if ((arg == "-var" || arg == "-uniform") && hasTwoValues && parseType(argv[i + 2], varType)) {
+            if (arg == "-var")
+                varType.Varying();
+            else
+                varType.Uniform();
+            creator.registerVariable(argv[i + 1], varType);
+            i += 2;
+        } else if (arg[0] != '-')
+            files.push_back(arg);
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (files.empty()) {
+        usage();
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<Expression>> expressions;
+    std::vector<Expression*> toWrite;
+    for (const std::string& file : files) {
+        std::ifstream stream(file.c_str());
+        if (!stream) {
+            std::cerr << "can't read " << file << std::endl;
+            return 1;
+        }
+        std::stringstream text;
+        text << stream.rdbuf();
+        expressions.emplace_back(new Expression(text.str(), type, Expression::UseLLVM));
+        expressions.back()->setVarBlockCreator(&creator);
+        expressions.back()->setEvaluationPrecision(precision);
+        toWrite.push_back(expressions.back().get());
+    }
+
+    bool object = output.size() > 2 && !output.compare(output.size() - 2, 2, ".o");
+    std::string objectPath = object ? output : output + ".o";
+    std::string error;
+    try {
+        if (!Expression::writePrecompiled(toWrite, objectPath, cpu, error)) {
+            std::cerr << error;
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    if (object) return 0;
+
+    // link the object into a shared library with the C++ compiler
+    const char* cxx = getenv("CXX");
+    std::string command = std::string(cxx ? cxx : "c++") + " -shared -o '" + output + "' '" + objectPath + "'";
+    int status = system(command.c_str());
+    std::remove(objectPath.c_str());
+    if (status) {
+        std::cerr << "failed: " << command << std::endl;
+        return 1;
+    }
+    return 0;
+}